@@ -0,0 +1,300 @@
+#pragma once
+
+#include <Mist_Common/include/UtilityMacros.h>
+#include "Sorting.h"
+#include <cstdio>
+#include <vector>
+#include <type_traits>
+
+// This file implements the sorting of collections that are too large to fit in memory.
+// The records are read from a file, sorted in runs that fit in the memory budget and spilled to temporary files,
+// the runs are then merged back together while streaming them in and out of memory.
+MIST_NAMESPACE
+
+namespace Detail {
+	// Every file buffer is at least this large, this bounds the amount of runs that are merged at once
+	constexpr size_t EXTERNAL_SORT_MINIMUM_BUFFER_SIZE = 4 * 1024;
+
+	// A buffered reader of fixed size records, the records are read from the file a full buffer at a time
+	template< typename RecordType >
+	class RecordReader {
+
+	public:
+
+		// -Public API-
+
+		// Retrieve the current record, the reader must not be exhausted
+		const RecordType& Current() const {
+			MIST_ASSERT(IsExhausted() == false);
+			return m_Buffer[m_ReadIndex];
+		}
+
+		// Move on to the next record, refilling the buffer from the file if it ran out
+		void Advance() {
+
+			MIST_ASSERT(IsExhausted() == false);
+			++m_ReadIndex;
+			if (m_ReadIndex == m_BufferCount) {
+				Refill();
+			}
+		}
+
+		bool IsExhausted() const {
+			return m_BufferCount == 0;
+		}
+
+		bool HasFailed() const {
+			return m_HasFailed;
+		}
+
+		// -Structors-
+
+		RecordReader(FILE* file, size_t bufferCount)
+			: m_File(file), m_Buffer(bufferCount) {
+
+			MIST_ASSERT(bufferCount > 0);
+			Refill();
+		}
+
+	private:
+
+		void Refill() {
+
+			m_ReadIndex = 0;
+			m_BufferCount = fread(m_Buffer.data(), sizeof(RecordType), m_Buffer.size(), m_File);
+			m_HasFailed = m_HasFailed || ferror(m_File) != 0;
+		}
+
+		FILE* m_File = nullptr;
+		std::vector<RecordType> m_Buffer;
+		size_t m_BufferCount = 0;
+		size_t m_ReadIndex = 0;
+		bool m_HasFailed = false;
+	};
+
+	// A buffered writer of fixed size records, the records are written to the file a full buffer at a time
+	template< typename RecordType >
+	class RecordWriter {
+
+	public:
+
+		// -Public API-
+
+		void Write(const RecordType& record) {
+
+			m_Buffer[m_BufferCount++] = record;
+			if (m_BufferCount == m_Buffer.size()) {
+				Flush();
+			}
+		}
+
+		// Write the buffered records to the file, returns false if the file couldn't be written to
+		bool Flush() {
+
+			if (m_BufferCount > 0 && fwrite(m_Buffer.data(), sizeof(RecordType), m_BufferCount, m_File) != m_BufferCount) {
+				m_HasFailed = true;
+			}
+			m_BufferCount = 0;
+			return m_HasFailed == false;
+		}
+
+		// -Structors-
+
+		RecordWriter(FILE* file, size_t bufferCount)
+			: m_File(file), m_Buffer(bufferCount) {
+
+			MIST_ASSERT(bufferCount > 0);
+		}
+
+	private:
+
+		FILE* m_File = nullptr;
+		std::vector<RecordType> m_Buffer;
+		size_t m_BufferCount = 0;
+		bool m_HasFailed = false;
+	};
+
+	// Merge the sorted runs of records into the output using a loser tree, the memory budget is split evenly
+	// between the buffers of the runs and the buffer of the output
+	template< typename RecordType, typename LessThan >
+	bool MergeRecordRuns(FILE** runs, size_t runCount, FILE* output, size_t memoryBudget, const LessThan& lessThan) {
+
+		const size_t bufferCount = Max(memoryBudget / (runCount + 1) / sizeof(RecordType), static_cast<size_t>(1));
+
+		std::vector<RecordReader<RecordType>> readers;
+		readers.reserve(runCount);
+		for (size_t i = 0; i < runCount; ++i) {
+			readers.emplace_back(runs[i], bufferCount);
+		}
+		RecordWriter<RecordType> writer(output, bufferCount);
+
+		// Equal records are taken from the earlier run first
+		auto beats = [&readers, &lessThan](size_t left, size_t right) {
+			if (readers[left].IsExhausted()) {
+				return false;
+			}
+			if (readers[right].IsExhausted()) {
+				return true;
+			}
+			if (lessThan(readers[right].Current(), readers[left].Current())) {
+				return false;
+			}
+			return lessThan(readers[left].Current(), readers[right].Current()) || left < right;
+		};
+
+		LoserTree tree;
+		tree.Build(runCount, beats);
+		while (readers[tree.Winner()].IsExhausted() == false) {
+			RecordReader<RecordType>& winner = readers[tree.Winner()];
+			writer.Write(winner.Current());
+			winner.Advance();
+			tree.ReplayWinner(beats);
+		}
+
+		bool hasFailed = false;
+		for (const auto& reader : readers) {
+			hasFailed = hasFailed || reader.HasFailed();
+		}
+		return writer.Flush() && hasFailed == false;
+	}
+
+	// Close the temporary files of the runs, this also removes them
+	inline void CloseRecordRuns(std::vector<FILE*>* runs) {
+
+		for (FILE* run : *runs) {
+			fclose(run);
+		}
+		runs->clear();
+	}
+
+	// Fill the memory budget with records, sort them and spill them to a temporary file until the input is exhausted.
+	// Returns false if a file couldn't be read or written, or if the input isn't a whole amount of records.
+	template< typename RecordType, typename Comparator, typename Projection >
+	bool CreateRecordRuns(FILE* input, std::vector<FILE*>* runs, size_t memoryBudget, Comparator& comparator, Projection& projection) {
+
+		std::vector<RecordType> records(memoryBudget / sizeof(RecordType));
+		while (true) {
+			// Read the bytes instead of the records in order to find a partial record at the end of the input
+			size_t byteCount = fread(records.data(), 1, records.size() * sizeof(RecordType), input);
+			if (ferror(input) != 0 || byteCount % sizeof(RecordType) != 0) {
+				return false;
+			}
+			if (byteCount == 0) {
+				return true;
+			}
+
+			size_t recordCount = byteCount / sizeof(RecordType);
+			QuickSort(records.data(), records.data() + recordCount, comparator, projection);
+
+			FILE* run = tmpfile();
+			if (run == nullptr) {
+				return false;
+			}
+			runs->push_back(run);
+
+			if (fwrite(records.data(), sizeof(RecordType), recordCount, run) != recordCount) {
+				return false;
+			}
+			rewind(run);
+		}
+	}
+
+	// Merge the runs into the output, when there are too many runs for every buffer to stay efficient
+	// the runs are first merged in groups into new temporary files. The runs are closed once they're merged.
+	template< typename RecordType, typename LessThan >
+	bool MergeAllRecordRuns(std::vector<FILE*>* runs, FILE* output, size_t memoryBudget, const LessThan& lessThan) {
+
+		// An empty input is an empty output
+		if (runs->empty()) {
+			return true;
+		}
+
+		// Merge as many runs at once as the budget allows while keeping every buffer large enough to stream efficiently
+		const size_t bufferSize = Max(EXTERNAL_SORT_MINIMUM_BUFFER_SIZE, sizeof(RecordType));
+		const size_t maximumFanIn = Max(memoryBudget / bufferSize, static_cast<size_t>(3)) - 1;
+		while (runs->size() > maximumFanIn) {
+
+			std::vector<FILE*> mergedRuns;
+			bool hasMerged = true;
+			for (size_t first = 0; first < runs->size() && hasMerged; first += maximumFanIn) {
+
+				FILE* mergedRun = tmpfile();
+				if (mergedRun == nullptr) {
+					hasMerged = false;
+					break;
+				}
+				mergedRuns.push_back(mergedRun);
+
+				size_t runCount = Min(maximumFanIn, runs->size() - first);
+				hasMerged = MergeRecordRuns<RecordType>(runs->data() + first, runCount, mergedRun, memoryBudget, lessThan);
+				rewind(mergedRun);
+			}
+
+			CloseRecordRuns(runs);
+			*runs = std::move(mergedRuns);
+			if (hasMerged == false) {
+				CloseRecordRuns(runs);
+				return false;
+			}
+		}
+
+		bool hasMerged = MergeRecordRuns<RecordType>(runs->data(), runs->size(), output, memoryBudget, lessThan);
+		CloseRecordRuns(runs);
+		return hasMerged && fflush(output) == 0;
+	}
+}
+
+// Sort the fixed size records of the input file into the output file while using at most about memoryBudget bytes of memory.
+// The records are read in runs that fill the memory budget, every run is sorted with QuickSort and spilled to a temporary file.
+// The runs are then merged with a loser tree while streaming them through buffers that share the memory budget.
+// When there are too many runs for every buffer to stay efficient, the runs are merged in multiple passes.
+// The sort isn't stable. It returns false if a file couldn't be read or written, or if the input isn't a whole amount of records.
+// @Detail: the files are only read and written sequentially, which keeps files larger than 4GB working with the stdio functions.
+//  The temporary files are created with tmpfile and are removed once they are closed.
+template< typename RecordType, typename Comparator = Less, typename Projection = Identity >
+bool ExternalSort(FILE* input, FILE* output, size_t memoryBudget, Comparator comparator = Comparator(), Projection projection = Projection()) {
+
+	static_assert(std::is_trivially_copyable<RecordType>::value, "External sort can only sort records that can be written to a file as is.");
+
+	MIST_ASSERT(input != nullptr);
+	MIST_ASSERT(output != nullptr);
+	MIST_ASSERT(memoryBudget >= sizeof(RecordType) * 2);
+
+	std::vector<FILE*> runs;
+	if (Detail::CreateRecordRuns<RecordType>(input, &runs, memoryBudget, comparator, projection) == false) {
+		Detail::CloseRecordRuns(&runs);
+		return false;
+	}
+
+	return Detail::MergeAllRecordRuns<RecordType>(&runs, output, memoryBudget, Detail::MakeProjectedLess(comparator, projection));
+}
+
+// This version of external sort opens the input and output files. The output is only created once the input
+// has been read completely, which allows the input and the output to be the same file.
+template< typename RecordType, typename Comparator = Less, typename Projection = Identity >
+bool ExternalSort(const char* inputPath, const char* outputPath, size_t memoryBudget, Comparator comparator = Comparator(), Projection projection = Projection()) {
+
+	static_assert(std::is_trivially_copyable<RecordType>::value, "External sort can only sort records that can be written to a file as is.");
+
+	MIST_ASSERT(memoryBudget >= sizeof(RecordType) * 2);
+
+	FILE* input = fopen(inputPath, "rb");
+	if (input == nullptr) {
+		return false;
+	}
+
+	std::vector<FILE*> runs;
+	bool hasCreatedRuns = Detail::CreateRecordRuns<RecordType>(input, &runs, memoryBudget, comparator, projection);
+	fclose(input);
+
+	FILE* output = hasCreatedRuns ? fopen(outputPath, "wb") : nullptr;
+	if (output == nullptr) {
+		Detail::CloseRecordRuns(&runs);
+		return false;
+	}
+
+	bool hasMerged = Detail::MergeAllRecordRuns<RecordType>(&runs, output, memoryBudget, Detail::MakeProjectedLess(comparator, projection));
+	return fclose(output) == 0 && hasMerged;
+}
+
+MIST_NAMESPACE_END
@@ -0,0 +1,271 @@
+#pragma once
+
+#include <Mist_Common/include/UtilityMacros.h>
+#include "Sorting.h"
+#include "../utility/CacheLine.h"
+#include <thread>
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <type_traits>
+
+// This file implements the sorting algorithms that split their work across multiple threads.
+// The work is handed to an executor, an executor is any callable with the signature:
+//		void operator()(size_t taskCount, TaskType&& task);
+// that calls task(taskIndex) for every taskIndex in [0, taskCount) and returns once all of them are done.
+// This allows the sorts to run on an engine's job system instead of spawning their own threads.
+MIST_NAMESPACE
+
+// The default executor, it runs every task on it's own thread and the first task on the calling thread
+struct ThreadExecutor {
+
+	template< typename TaskType >
+	void operator()(size_t taskCount, TaskType&& task) const {
+
+		std::vector<std::thread> threads;
+		threads.reserve(taskCount);
+		for (size_t i = 1; i < taskCount; ++i) {
+			threads.emplace_back([&task, i]() { task(i); });
+		}
+
+		task(0);
+
+		for (auto& thread : threads) {
+			thread.join();
+		}
+	}
+};
+
+namespace Detail {
+	// Below this amount of values per task, the cost of spreading the work outweighs the gains
+	constexpr size_t PARALLEL_SORT_MINIMUM_TASK_SIZE = 4096;
+
+	// Determine if the comparator can compare the projected values, this tells the comparators and the executors apart
+	template< typename Comparator, typename Projection, typename ValueType, typename TemplateCondition = void >
+	struct IsComparatorOf : std::false_type {};
+
+	template< typename Comparator, typename Projection, typename ValueType >
+	struct IsComparatorOf<Comparator, Projection, ValueType, typename std::enable_if<std::is_convertible<decltype(std::declval<Comparator&>()(
+		std::declval<Projection&>()(std::declval<ValueType&>()), std::declval<Projection&>()(std::declval<ValueType&>()))), bool>::value>::type> : std::true_type {};
+
+	// Merge the pairs of adjacent runs of source into destination, only writing the output range [outputBegin, outputEnd).
+	// @Detail: the runs are described by their start offsets, the last offset is the end of the collection.
+	//  The co-rank of the output range is used to find which part of each pair of runs ends up in the output range.
+	template< typename ValueType, typename LessThan >
+	void MergeRunPairs(ValueType* source, ValueType* destination, const std::vector<size_t>& runStarts, size_t outputBegin, size_t outputEnd, const LessThan& lessThan) {
+
+		size_t runCount = runStarts.size() - 1;
+		for (size_t run = 0; run < runCount; run += 2) {
+
+			size_t pairBegin = runStarts[run];
+			size_t pairMiddle = runStarts[run + 1];
+			size_t pairEnd = runStarts[Detail::Min(run + 2, runCount)];
+
+			// Skip the pairs that don't overlap our output range
+			if (pairEnd <= outputBegin || pairBegin >= outputEnd) {
+				continue;
+			}
+
+			size_t localBegin = Detail::Max(outputBegin, pairBegin) - pairBegin;
+			size_t localEnd = Detail::Min(outputEnd, pairEnd) - pairBegin;
+
+			ValueType* left = source + pairBegin;
+			ValueType* right = source + pairMiddle;
+			size_t leftSize = pairMiddle - pairBegin;
+			size_t rightSize = pairEnd - pairMiddle;
+
+			size_t leftBegin = MergeCoRank(localBegin, left, leftSize, right, rightSize, lessThan);
+			size_t leftEnd = MergeCoRank(localEnd, left, leftSize, right, rightSize, lessThan);
+
+			MergeRanges(left + leftBegin, left + leftEnd,
+				right + (localBegin - leftBegin), right + (localEnd - leftEnd), destination + pairBegin + localBegin, lessThan);
+		}
+	}
+}
+
+// -Parallel Merge Sort-
+
+// Sort the range by splitting it into one chunk per task, every chunk is merge sorted independently
+// and the chunks are then merged together in log(taskCount) passes. Every merge pass is also split evenly across
+// the tasks by splitting the output of the merges with their co-rank (merge path), which keeps all of the tasks busy
+// until the very last merge. The sort is stable and uses O(n) extra memory.
+// Like the other sorts, it takes an optional comparator and projection.
+template< typename ValueType, typename Executor, typename Comparator = Less, typename Projection = Identity,
+	// @Template condition: the executor must not be a comparator, this keeps the comparators on the thread count version
+	typename TemplateCondition = typename std::enable_if<Detail::IsComparatorOf<Comparator, Projection, ValueType>::value
+		&& Detail::IsComparatorOf<typename std::decay<Executor>::type, Projection, ValueType>::value == false>::type>
+void ParallelMergeSort(ValueType* begin, ValueType* end, size_t taskCount, Executor&& executor, Comparator comparator = Comparator(), Projection projection = Projection()) {
+
+	const auto lessThan = Detail::MakeProjectedLess(comparator, projection);
+	const size_t collectionSize = static_cast<size_t>(end - begin);
+	taskCount = Detail::Min(taskCount, collectionSize / Detail::PARALLEL_SORT_MINIMUM_TASK_SIZE);
+
+	// Not worth splitting, sort on the calling thread
+	if (taskCount <= 1) {
+		MergeSort(begin, end, comparator, projection);
+		return;
+	}
+
+	// Determine the chunk boundaries, every task gets an even share of the collection
+	std::vector<size_t> runStarts(taskCount + 1);
+	for (size_t i = 0; i <= taskCount; ++i) {
+		runStarts[i] = collectionSize * i / taskCount;
+	}
+
+	// The chunks borrow their part of the working area, which saves an allocation per chunk
+	std::vector<ValueType> workingArea(collectionSize);
+	executor(taskCount, [begin, &workingArea, &runStarts, &comparator, &projection](size_t task) {
+		MergeSort(begin + runStarts[task], begin + runStarts[task + 1], workingArea.data() + runStarts[task], comparator, projection);
+	});
+
+	ValueType* readTarget = begin;
+	ValueType* writeTarget = workingArea.data();
+
+	// Keep merging pairs of runs until only one run is left
+	while (runStarts.size() > 2) {
+
+		executor(taskCount, [readTarget, writeTarget, &runStarts, collectionSize, taskCount, &lessThan](size_t task) {
+			Detail::MergeRunPairs(readTarget, writeTarget, runStarts,
+				collectionSize * task / taskCount, collectionSize * (task + 1) / taskCount, lessThan);
+		});
+
+		// Every pair of runs is now a single run
+		std::vector<size_t> mergedRunStarts;
+		for (size_t i = 0; i < runStarts.size() - 1; i += 2) {
+			mergedRunStarts.push_back(runStarts[i]);
+		}
+		mergedRunStarts.push_back(collectionSize);
+		runStarts = std::move(mergedRunStarts);
+
+		std::swap(writeTarget, readTarget);
+	}
+
+	// Move the result back if the last pass wrote into the working area
+	if (readTarget != begin) {
+		executor(taskCount, [readTarget, begin, collectionSize, taskCount](size_t task) {
+			size_t copyBegin = collectionSize * task / taskCount;
+			size_t copyEnd = collectionSize * (task + 1) / taskCount;
+			std::move(readTarget + copyBegin, readTarget + copyEnd, begin + copyBegin);
+		});
+	}
+}
+
+// This version of parallel merge sort runs the tasks on their own threads,
+// by default it uses as many threads as the hardware supports
+template< typename ValueType, typename Comparator = Less, typename Projection = Identity,
+	// @Template condition: the comparator must be able to compare the projected values, this keeps the executors on the executor version
+	typename TemplateCondition = typename std::enable_if<Detail::IsComparatorOf<Comparator, Projection, ValueType>::value>::type>
+void ParallelMergeSort(ValueType* begin, ValueType* end, size_t threadCount = std::thread::hardware_concurrency(), Comparator comparator = Comparator(), Projection projection = Projection()) {
+	ParallelMergeSort(begin, end, threadCount, ThreadExecutor(), comparator, projection);
+}
+
+// -Parallel Bucket Sort-
+
+// Sort the values by a small integer key in the inclusive range [min, max] across multiple tasks.
+// Every task counts the keys of it's own chunk into it's own histogram, the histograms are then turned into the offsets
+// of every task in every bucket, ordered by bucket and then by task which keeps the sort stable.
+// Every task then scatters it's own chunk to it's offsets, no two tasks ever write to the same place.
+// @Detail: the histograms are padded to a cache line in order to avoid false sharing between the tasks.
+template< typename ValueType, typename Executor, typename KeyType, typename KeyExtractor = Identity >
+void ParallelBucketSort(ValueType* begin, ValueType* end, size_t taskCount, Executor&& executor, const KeyType min, const KeyType max, KeyExtractor keyExtractor = KeyExtractor()) {
+
+	MIST_ASSERT(max >= min);
+
+	const size_t collectionSize = static_cast<size_t>(end - begin);
+	taskCount = Detail::Min(taskCount, collectionSize / Detail::PARALLEL_SORT_MINIMUM_TASK_SIZE);
+
+	// Not worth splitting, sort on the calling thread
+	if (taskCount <= 1) {
+		BucketSort(begin, end, min, max, keyExtractor);
+		return;
+	}
+
+	const size_t bucketCount = static_cast<size_t>(max - min) + 1;
+	const size_t countsPerLine = CACHE_LINE_SIZE / sizeof(size_t);
+	const size_t histogramStride = (bucketCount + countsPerLine - 1) / countsPerLine * countsPerLine;
+
+	std::vector<size_t> histograms(histogramStride * taskCount);
+	auto chunkBegin = [collectionSize, taskCount](size_t task) { return collectionSize * task / taskCount; };
+
+	executor(taskCount, [&](size_t task) {
+		size_t* counts = histograms.data() + histogramStride * task;
+		for (size_t i = chunkBegin(task); i < chunkBegin(task + 1); ++i) {
+
+			KeyType key = static_cast<KeyType>(keyExtractor(begin[i]));
+			MIST_ASSERT(key >= min);
+			MIST_ASSERT(key <= max);
+
+			++counts[static_cast<size_t>(key - min)];
+		}
+	});
+
+	// Turn the counts into the offsets of every task, the first task writes first in every bucket
+	size_t offset = 0;
+	for (size_t bucket = 0; bucket < bucketCount; ++bucket) {
+		for (size_t task = 0; task < taskCount; ++task) {
+			size_t& count = histograms[histogramStride * task + bucket];
+			size_t bucketTaskCount = count;
+			count = offset;
+			offset += bucketTaskCount;
+		}
+	}
+
+	std::vector<ValueType> workingArea(collectionSize);
+	executor(taskCount, [&](size_t task) {
+		size_t* offsets = histograms.data() + histogramStride * task;
+		for (size_t i = chunkBegin(task); i < chunkBegin(task + 1); ++i) {
+			size_t bucket = static_cast<size_t>(static_cast<KeyType>(keyExtractor(begin[i])) - min);
+			workingArea[offsets[bucket]++] = std::move(begin[i]);
+		}
+	});
+
+	executor(taskCount, [&](size_t task) {
+		std::move(workingArea.data() + chunkBegin(task), workingArea.data() + chunkBegin(task + 1), begin + chunkBegin(task));
+	});
+}
+
+// -Parallel Sorted Runs Merge-
+
+// Merge a collection of sorted runs into the output across multiple tasks, the output must be random access.
+// The output is split evenly between the tasks, every task finds where it's part of the output starts in every run
+// and merges it's part with it's own loser tree. Equal values are merged in the order of their runs, like MergeSortedRuns.
+template< typename RunCollectionType, typename OutputIterator, typename Executor, typename Comparator = Less, typename Projection = Identity,
+	// @Template condition: the runs must be a collection of collections
+	typename TemplateCondition = decltype(std::begin(*std::begin(std::declval<const RunCollectionType&>())))>
+void ParallelMergeSortedRuns(const RunCollectionType& runs, OutputIterator output, size_t taskCount, Executor&& executor, Comparator comparator = Comparator(), Projection projection = Projection()) {
+
+	using RunIterator = decltype(std::begin(*std::begin(runs)));
+
+	std::vector<Detail::SortedRun<RunIterator>> sortedRuns;
+	size_t collectionSize = 0;
+	for (const auto& run : runs) {
+		sortedRuns.push_back({ std::begin(run), std::end(run) });
+		collectionSize += static_cast<size_t>(std::distance(std::begin(run), std::end(run)));
+	}
+	taskCount = Detail::Min(taskCount, collectionSize / Detail::PARALLEL_SORT_MINIMUM_TASK_SIZE);
+
+	// Not worth splitting, merge on the calling thread
+	if (taskCount <= 1) {
+		MergeSortedRuns(runs, output, comparator, projection);
+		return;
+	}
+
+	const auto lessThan = Detail::MakeProjectedLess(comparator, projection);
+	executor(taskCount, [&](size_t task) {
+		size_t outputBegin = collectionSize * task / taskCount;
+		size_t outputEnd = collectionSize * (task + 1) / taskCount;
+
+		std::vector<RunIterator> splitBegins(sortedRuns.size());
+		std::vector<RunIterator> splitEnds(sortedRuns.size());
+		Detail::SplitSortedRuns(sortedRuns, outputBegin, splitBegins.data(), lessThan);
+		Detail::SplitSortedRuns(sortedRuns, outputEnd, splitEnds.data(), lessThan);
+
+		SortedRunMerger<RunIterator, Comparator, Projection> merger(comparator, projection);
+		for (size_t i = 0; i < sortedRuns.size(); ++i) {
+			merger.AddRun(splitBegins[i], splitEnds[i]);
+		}
+		merger.Merge(output + outputBegin, outputEnd - outputBegin);
+	});
+}
+
+MIST_NAMESPACE_END
@@ -1,39 +1,207 @@
 #pragma once
 
 #include <Mist_Common/include/UtilityMacros.h>
+#include "SortingNetworks.h"
 #include <type_traits>
 #include <iterator>
-#include <stack>
 #include <utility>
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
 
 // This file implements a series of sorting algorithms useful for sorting different
 // types of data structures. Sorting functions that will be implemented are:
 // - QuickSort
 // - MergeSort
+// - TimSort
 // - InsertionSort
 // - HeapSort
+// - PartialSort
+// - NthElement
+// - MergeSortedRuns
+// - ArgSort
 // - BucketSort
-// Possibly: Limited amount of memory sort, external sorting
+// The sorting networks used for small ranges of integers and floats are implemented in SortingNetworks.h
+// The external sorting of collections that don't fit in memory is implemented in ExternalSorting.h
 MIST_NAMESPACE
 
+// The default comparator of the sorting algorithms, orders the values with operator<
+struct Less {
+	template< typename LeftType, typename RightType >
+	bool operator()(const LeftType& left, const RightType& right) const {
+		return left < right;
+	}
+};
+
+// The default projection of the sorting algorithms, the values are compared as they are
+struct Identity {
+	template< typename ValueType >
+	const ValueType& operator()(const ValueType& value) const {
+		return value;
+	}
+};
+
 namespace Detail {
+	// Combines a comparator and a projection into a single predicate that determines if a value goes before another,
+	// the sorting implementations only ever use this predicate.
+	template< typename Comparator, typename Projection >
+	struct ProjectedLess {
+		Comparator m_Comparator;
+		Projection m_Projection;
+
+		template< typename LeftType, typename RightType >
+		bool operator()(const LeftType& left, const RightType& right) const {
+			return m_Comparator(m_Projection(left), m_Projection(right));
+		}
+	};
+
+	template< typename Comparator, typename Projection >
+	ProjectedLess<Comparator, Projection> MakeProjectedLess(Comparator comparator, Projection projection) {
+		return { comparator, projection };
+	}
+
 	// Internal method for minimum of two values
 	template< typename MinType >
 	MinType Min(MinType left, MinType right) {
 		return left < right ? left : right;
 	}
+
+	// Internal method for maximum of two values
+	template< typename MaxType >
+	MaxType Max(MaxType left, MaxType right) {
+		return left < right ? right : left;
+	}
+
+	// Straight insertion sort of a range, values are moved instead of swapped
+	template< typename IteratorType, typename LessThan >
+	void InsertionSortRange(IteratorType begin, IteratorType end, const LessThan& lessThan) {
+
+		if (begin == end) {
+			return;
+		}
+
+		for (IteratorType current = begin + 1; current != end; ++current) {
+			// Only pick up the value if it's out of place
+			if (lessThan(*current, *(current - 1))) {
+				typename std::iterator_traits<IteratorType>::value_type value = std::move(*current);
+				IteratorType hole = current;
+				do {
+					*hole = std::move(*(hole - 1));
+					--hole;
+				} while (hole != begin && lessThan(value, *(hole - 1)));
+				*hole = std::move(value);
+			}
+		}
+	}
+
+	// Determine if a small range can be sorted with a sorting network, this is the case when the values have a vectorized network,
+	// the values are in contiguous memory and they are sorted in the default order.
+	template< typename IteratorType, typename LessThan, bool tIsStable >
+	struct UsesSortingNetwork {
+		using ValueType = typename std::iterator_traits<IteratorType>::value_type;
+
+		// Without vector lanes, the padded network does more work than an insertion sort
+		static constexpr bool value = HasVectorSortingNetwork<ValueType>::value
+			&& std::is_same<LessThan, ProjectedLess<Less, Identity>>::value
+			&& (std::is_pointer<IteratorType>::value || std::is_same<IteratorType, typename std::vector<ValueType>::iterator>::value)
+			// Equal floats can still be different values such as -0.0f and 0.0f, a stable sort can't swap them
+			&& (tIsStable == false || std::is_integral<ValueType>::value);
+	};
+
+	template< typename IteratorType, typename LessThan >
+	void SmallSortRange(IteratorType begin, IteratorType end, const LessThan& lessThan, std::false_type /*UsesSortingNetwork*/) {
+		InsertionSortRange(begin, end, lessThan);
+	}
+
+	template< typename IteratorType, typename LessThan >
+	void SmallSortRange(IteratorType begin, IteratorType end, const LessThan& /*lessThan*/, std::true_type /*UsesSortingNetwork*/) {
+
+		if (end - begin > 1) {
+			auto* values = &*begin;
+			NetworkSort(values, values + (end - begin));
+		}
+	}
+
+	// Sort a range of at most SORTING_NETWORK_MAXIMUM_SIZE values, with a sorting network if possible
+	// and with an insertion sort otherwise.
+	template< bool tIsStable, typename IteratorType, typename LessThan >
+	void SmallSortRange(IteratorType begin, IteratorType end, const LessThan& lessThan) {
+
+		MIST_ASSERT(static_cast<size_t>(end - begin) <= SORTING_NETWORK_MAXIMUM_SIZE);
+		SmallSortRange(begin, end, lessThan, std::integral_constant<bool, UsesSortingNetwork<IteratorType, LessThan, tIsStable>::value>());
+	}
+
+	// Merge the sorted ranges [left, leftEnd) and [right, rightEnd) into the output, the values are moved into the output.
+	// The merge is stable, when two values are equal the value from the left range is written first.
+	template< typename InputIterator, typename OutputIterator, typename LessThan >
+	OutputIterator MergeRanges(InputIterator left, InputIterator leftEnd, InputIterator right, InputIterator rightEnd, OutputIterator output, const LessThan& lessThan) {
+
+		// Loop through both ranges and determine which part goes into the output first
+		while (left != leftEnd && right != rightEnd) {
+			// if the right is lower, that means we write that one first
+			if (lessThan(*right, *left)) {
+				*output = std::move(*right);
+				++right;
+			}
+			else {
+				*output = std::move(*left);
+				++left;
+			}
+			++output;
+		}
+
+		// One of the ranges has run out, write the rest of the other one
+		output = std::move(left, leftEnd, output);
+		return std::move(right, rightEnd, output);
+	}
+
+	// Determine how many values of the left range are part of the first outputIndex values of the stable merge
+	// of the left and right ranges, this is also known as the co-rank of outputIndex.
+	// @Detail: this lets the output of a merge be split into independent pieces, such as for a parallel merge.
+	//  It runs in O(log(n)) time using a binary search on the merge path.
+	template< typename RandomIterator, typename LessThan >
+	size_t MergeCoRank(size_t outputIndex, RandomIterator left, size_t leftSize, RandomIterator right, size_t rightSize, const LessThan& lessThan) {
+
+		MIST_ASSERT(outputIndex <= leftSize + rightSize);
+
+		size_t low = outputIndex > rightSize ? outputIndex - rightSize : 0;
+		size_t high = Min(outputIndex, leftSize);
+
+		while (true) {
+			size_t leftCount = low + (high - low) / 2;
+			size_t rightCount = outputIndex - leftCount;
+
+			// We took too many values from the left, the last one taken comes after the next right value
+			if (leftCount > 0 && rightCount < rightSize && lessThan(right[rightCount], left[leftCount - 1])) {
+				high = leftCount - 1;
+			}
+			// We took too few values from the left, the next left value comes before the last right value taken
+			else if (rightCount > 0 && leftCount < leftSize && lessThan(right[rightCount - 1], left[leftCount]) == false) {
+				low = leftCount + 1;
+			}
+			else {
+				return leftCount;
+			}
+		}
+	}
 }
 
 
 
 // -Utility Methods-
 
-// Determine if a collection is sorted in O(n) time
-template< typename IteratorType,
-// @Template condition: Assure that the iterator value type is comparable
+// Determine if a collection is sorted in O(n) time.
+// Every sorting algorithm takes an optional comparator and projection, the values are ordered with
+// comparator(projection(left), projection(right)). By default the values themselves are compared with operator<.
+template< typename IteratorType, typename Comparator = Less, typename Projection = Identity,
+// @Template condition: Assure that the projected iterator value type is comparable
 // @Detail: This uses declval and decltype in order to test an expression and see if the return type is correct
-typename TemplateCondition = typename std::enable_if<std::is_convertible<decltype(std::declval<typename std::iterator_traits<IteratorType>::value_type>() < std::declval<typename std::iterator_traits<IteratorType>::value_type>()), bool>::value>::type>
-bool IsSorted(IteratorType begin, IteratorType end) {
+typename TemplateCondition = typename std::enable_if<std::is_convertible<decltype(std::declval<Comparator>()(
+	std::declval<Projection>()(*std::declval<IteratorType>()), std::declval<Projection>()(*std::declval<IteratorType>()))), bool>::value>::type>
+bool IsSorted(IteratorType begin, IteratorType end, Comparator comparator = Comparator(), Projection projection = Projection()) {
 	
 	// The begin and end iterators cannot be the same
 	MIST_ASSERT(begin != end);
@@ -42,7 +210,7 @@ bool IsSorted(IteratorType begin, IteratorType end) {
 	IteratorType next = begin + 1;
 	for (; next != end; ++begin, ++next) {
 		// If the next element is lower than the beginning one, the collection isn't sorted
-		if (*next < *begin) {
+		if (comparator(projection(*next), projection(*begin))) {
 			return false;
 		}
 	}
@@ -53,312 +221,1169 @@ bool IsSorted(IteratorType begin, IteratorType end) {
 
 // -Merge Sort-
 
-// The main implementation of merge sort will not be recursive, it uses O(n) extra memory
-// the original collection is modified.
-// @Detail: the implementation uses a swapping read and write buffers of size n and swaps between
-//   them every change in block size.
-template< typename CollectionType, typename IndexType = size_t >
-void MergeSort(CollectionType* collection) {
+namespace Detail {
+	// The runs that are sorted in place before the merge passes start at this size, the runs can be up to twice as large
+	constexpr size_t MERGE_SORT_RUN_SIZE = 16;
+
+	// Merge sort the range using the working area, the working area must hold at least size values.
+	// @Detail: the range is first split into runs that are insertion sorted or sorted with a sorting network in place, the runs are then merged in passes
+	//  that swap between the range and the working area. The run size is picked so that the amount of passes is even,
+	//  this leaves the sorted values in the range and the values never have to be copied back.
+	template< typename IndexType, typename IteratorType, typename WorkingIteratorType, typename LessThan >
+	void MergeSortWithWorkingArea(IteratorType begin, size_t collectionSize, WorkingIteratorType workingArea, const LessThan& lessThan) {
+
+		size_t runSize = MERGE_SORT_RUN_SIZE;
+		size_t passCount = 0;
+		for (size_t blockSize = runSize; blockSize < collectionSize; blockSize += blockSize) {
+			++passCount;
+		}
 
-	const size_t collectionSize = collection->size();
-	size_t blockSize = 1;
+		// Doubling the runs removes a pass, this makes the amount of passes even
+		if (passCount % 2 == 1) {
+			runSize += runSize;
+		}
 
-	// Create our block iterators
-	IndexType first, last, firstNext, lastNext;
-	IndexType writeHead = 0;
+		for (size_t i = 0; i < collectionSize; i += runSize) {
+			SmallSortRange<true>(begin + i, begin + Min(i + runSize, collectionSize), lessThan);
+		}
 
-	// Create our working area
-	CollectionType workingArea(collectionSize);
+		// Create our block iterators
+		IndexType first, last, firstNext, lastNext;
 
-	CollectionType* writeTarget = &workingArea;
-	CollectionType* readTarget = &*collection;
-
-	// Keep going until we've passed the collection size for a block
-	while (blockSize < collectionSize) {
-
-		// Loop through all the block pairs in intervals of 2
-		// Integer division will truncate which is expected behaviour
-		size_t numBlocks = collectionSize / blockSize;
-		for (size_t i = 0; i < numBlocks; i+=2) {
-			// Select our first blocks
-			first = i * blockSize;
-			last = (i + 1) * blockSize;
-
-			// Select our next blocks
-			firstNext = (i + 1) * blockSize;
-			// Assure that we don't go over the bounds of the collection
-			lastNext = Detail::Min((i + 2) * blockSize, collectionSize);
-
-			// Loop through both ranges and determine which part goes into the write first
-			// keep going until we've written all of them
-			while (firstNext != lastNext || first != last) {
-				// if we've run out of the next block, write all the previous block
-				if (firstNext == lastNext) {
-					(*writeTarget)[writeHead++] = (*readTarget)[first++];
-				}
-				// if we've run out of the previous block, write all of the next block
-				else if (first == last) {
-					(*writeTarget)[writeHead++] = (*readTarget)[firstNext++];
-				}
-				// if the first is lower, that means we write that one and advance the write head
-				else if ((*readTarget)[firstNext] < (*readTarget)[first]) {
-					(*writeTarget)[writeHead++] = (*readTarget)[firstNext++];
+		// Keep going until we've passed the collection size for a block, every pass swaps the read and write targets
+		bool readFromWorkingArea = false;
+		for (size_t blockSize = runSize; blockSize < collectionSize; blockSize += blockSize) {
+
+			// Loop through all the block pairs, the last pair might be cut short by the end of the collection
+			for (size_t i = 0; i < collectionSize; i += 2 * blockSize) {
+				// Select our first blocks
+				first = i;
+				last = Min(i + blockSize, collectionSize);
+
+				// Select our next blocks
+				firstNext = last;
+				// Assure that we don't go over the bounds of the collection
+				lastNext = Min(i + 2 * blockSize, collectionSize);
+
+				if (readFromWorkingArea) {
+					MergeRanges(workingArea + first, workingArea + last, workingArea + firstNext, workingArea + lastNext, begin + first, lessThan);
 				}
 				else {
-					(*writeTarget)[writeHead++] = (*readTarget)[first++];
+					MergeRanges(begin + first, begin + last, begin + firstNext, begin + lastNext, workingArea + first, lessThan);
 				}
 			}
+
+			readFromWorkingArea = !readFromWorkingArea;
 		}
 
-		// swap our read and write bodies and reset the write head
-		std::swap(writeTarget, readTarget);
-		writeHead = 0;
+		MIST_ASSERT(readFromWorkingArea == false);
+	}
+}
+
+// The main implementation of merge sort will not be recursive, it uses O(n) extra memory
+// the original collection is modified. The values are moved, never copied.
+// @Detail: the implementation swaps between the collection and a working area of size n
+//   every change in block size, the amount of passes is always even which leaves the values in the collection.
+template< typename CollectionType, typename IndexType = size_t, typename Comparator = Less, typename Projection = Identity,
+	// @Template condition: the collection must be iterable, this keeps pointer ranges on the range version
+	typename TemplateCondition = decltype(std::begin(std::declval<CollectionType&>()))>
+void MergeSort(CollectionType* collection, Comparator comparator = Comparator(), Projection projection = Projection()) {
+
+	const size_t collectionSize = collection->size();
+	if (collectionSize < 2) {
+		return;
+	}
+
+	// Create our working area
+	CollectionType workingArea(collectionSize);
+
+	Detail::MergeSortWithWorkingArea<IndexType>(std::begin(*collection), collectionSize, std::begin(workingArea),
+		Detail::MakeProjectedLess(comparator, projection));
+}
+
 
-		// Increase our block size by the current blockSize
-		blockSize += blockSize;
+// This version of merge sort sorts an array range using the working area provided by the caller.
+// The working area must hold at least end - begin values, it's content is left in an unspecified state.
+// This allows the same working area to be reused when the same values are sorted repeatedly.
+template< typename ValueType, typename IndexType = size_t, typename Comparator = Less, typename Projection = Identity >
+void MergeSort(ValueType* begin, ValueType* end, ValueType* workingArea, Comparator comparator = Comparator(), Projection projection = Projection()) {
+
+	const size_t collectionSize = static_cast<size_t>(end - begin);
+	if (collectionSize < 2) {
+		return;
 	}
 
-	std::copy(std::begin(*readTarget), std::end(*readTarget), std::begin(*collection));
+	MIST_ASSERT(workingArea != nullptr);
+	Detail::MergeSortWithWorkingArea<IndexType>(begin, collectionSize, workingArea, Detail::MakeProjectedLess(comparator, projection));
 }
 
+// This version of merge sort sorts an array range with a working area allocated from the allocator,
+// the allocator only needs to implement Alloc(size) and Free(block) such as the CppAllocator or the LinearArenaAllocator.
+// @Detail: the working area is default constructed, for trivial types this doesn't touch the memory.
+template< typename ValueType, typename Allocator, typename IndexType = size_t, typename Comparator = Less, typename Projection = Identity,
+	// @Template condition: the allocator must be able to allocate a block of memory
+	typename TemplateCondition = decltype(std::declval<Allocator&>().Alloc(size_t()))>
+void MergeSort(ValueType* begin, ValueType* end, Allocator& allocator, Comparator comparator = Comparator(), Projection projection = Projection()) {
+
+	const size_t collectionSize = static_cast<size_t>(end - begin);
+	if (collectionSize < 2) {
+		return;
+	}
+
+	ValueType* workingArea = static_cast<ValueType*>(allocator.Alloc(sizeof(ValueType) * collectionSize));
+	MIST_ASSERT(workingArea != nullptr);
+	for (size_t i = 0; i < collectionSize; i++) {
+		new (workingArea + i) ValueType;
+	}
+
+	Detail::MergeSortWithWorkingArea<IndexType>(begin, collectionSize, workingArea, Detail::MakeProjectedLess(comparator, projection));
+
+	for (size_t i = 0; i < collectionSize; i++) {
+		workingArea[i].~ValueType();
+	}
+	allocator.Free(static_cast<void*>(workingArea));
+}
 
 // The main implementation of merge sort will not be recursive, it uses O(n) extra memory
 // the original collection is also modified. This is the version that sorts an array range
-// @Detail: the implementation uses a swapping read and write buffers of size n and swaps between
-//   them every change in block size.
-template< typename ValueType, typename IndexType = size_t >
-void MergeSort(ValueType* begin, ValueType* end) {
+// @Detail: the working area is allocated on every call, use the working area or allocator versions
+//   to avoid the allocation when sorting repeatedly.
+template< typename ValueType, typename IndexType = size_t, typename Comparator = Less, typename Projection = Identity,
+	// @Template condition: the comparator must be able to compare the projected values,
+	// this keeps the working area and allocator arguments on their own versions
+	typename TemplateCondition = decltype(std::declval<Comparator&>()(std::declval<Projection&>()(std::declval<ValueType&>()), std::declval<Projection&>()(std::declval<ValueType&>())))>
+void MergeSort(ValueType* begin, ValueType* end, Comparator comparator = Comparator(), Projection projection = Projection()) {
 
 	const size_t collectionSize = static_cast<size_t>(end - begin);
-	size_t blockSize = 1;
-
-	// Create our block iterators
-	IndexType first, last, firstNext, lastNext;
-	IndexType writeHead = 0;
+	if (collectionSize < 2) {
+		return;
+	}
 
 	// Create our working area, use a vector for the resource management and it's cleaner than std::unique_ptr<ValueType[]>
 	std::vector<ValueType> workingArea(collectionSize);
+	MergeSort<ValueType, IndexType>(begin, end, workingArea.data(), comparator, projection);
+}
 
-	ValueType* writeTarget = workingArea.data();
-	ValueType* readTarget = begin;
 
-	// Keep going until we've passed the collection size for a block
-	while (blockSize < collectionSize) {
-
-		// Loop through all the block pairs in intervals of 2
-		// Integer division will truncate which is expected behaviour
-		size_t numBlocks = collectionSize / blockSize;
-		for (size_t i = 0; i < numBlocks; i += 2) {
-			// Select our first blocks
-			first = i * blockSize;
-			last = (i + 1) * blockSize;
-
-			// Select our next blocks
-			firstNext = (i + 1) * blockSize;
-			// Assure that we don't go over the bounds of the collection
-			lastNext = Detail::Min((i + 2) * blockSize, collectionSize);
-
-			// Loop through both ranges and determine which part goes into the write first
-			// keep going until we've written all of them
-			while (firstNext != lastNext || first != last) {
-				// if we've run out of the next block, write all the previous block
-				if (firstNext == lastNext) {
-					writeTarget[writeHead++] = readTarget[first++];
+
+// -Tim Sort-
+
+namespace Detail {
+	// Collections under this size are sorted with a single binary insertion sort
+	constexpr size_t TIM_SORT_MINIMUM_MERGE = 64;
+	// After this many values in a row are taken from the same run, the merge switches to galloping
+	constexpr size_t TIM_SORT_MINIMUM_GALLOP = 7;
+	// The run sizes on the stack grow at least as fast as the fibonacci sequence, this covers any 64 bit size
+	constexpr size_t TIM_SORT_STACK_SIZE = 85;
+
+	// Insertion sort the range using a binary search to find the insertion point, the values in [begin, sortedEnd) must already be sorted.
+	// @Detail: the insertion point is after the equal values which keeps the sort stable
+	template< typename IteratorType, typename LessThan >
+	void BinaryInsertionSortRange(IteratorType begin, IteratorType sortedEnd, IteratorType end, const LessThan& lessThan) {
+
+		for (IteratorType current = sortedEnd; current != end; ++current) {
+			IteratorType insertion = std::upper_bound(begin, current, *current, lessThan);
+			if (insertion != current) {
+				typename std::iterator_traits<IteratorType>::value_type value = std::move(*current);
+				std::move_backward(insertion, current, current + 1);
+				*insertion = std::move(value);
+			}
+		}
+	}
+
+	// Find the first value of the range that goes after value, the search starts at the front of the range
+	// and doubles it's step until it overshoots before doing a binary search. This finds values near the front in O(log(k)).
+	template< typename IteratorType, typename ValueType, typename LessThan >
+	IteratorType GallopUpperBound(IteratorType begin, IteratorType end, const ValueType& value, const LessThan& lessThan) {
+
+		size_t size = static_cast<size_t>(end - begin);
+		size_t low = 0;
+		size_t high = 1;
+		while (high <= size && lessThan(value, begin[high - 1]) == false) {
+			low = high;
+			high += high;
+		}
+		return std::upper_bound(begin + low, begin + Min(high, size), value, lessThan);
+	}
+
+	// Find the first value of the range that doesn't go before value, using the same galloping search as GallopUpperBound
+	template< typename IteratorType, typename ValueType, typename LessThan >
+	IteratorType GallopLowerBound(IteratorType begin, IteratorType end, const ValueType& value, const LessThan& lessThan) {
+
+		size_t size = static_cast<size_t>(end - begin);
+		size_t low = 0;
+		size_t high = 1;
+		while (high <= size && lessThan(begin[high - 1], value)) {
+			low = high;
+			high += high;
+		}
+		return std::lower_bound(begin + low, begin + Min(high, size), value, lessThan);
+	}
+
+	// Merge the adjacent sorted runs [begin, middle) and [middle, end) in place using the working area.
+	// The merge is stable, like MergeRanges the values of the left run are written first when the values are equal.
+	// @Detail: the values that are already in place at both ends are skipped with a gallop, only the rest of the left run
+	//  is moved to the working area. When one of the runs keeps winning, the merge gallops to find how many values
+	//  it wins in a row and moves them all at once, which makes merging runs that barely interleave close to O(log(n)).
+	template< typename IteratorType, typename WorkingAreaType, typename LessThan >
+	void GallopingMerge(IteratorType begin, IteratorType middle, IteratorType end, WorkingAreaType& workingArea, const LessThan& lessThan) {
+
+		// The front of the left run that goes before the right run is already in place
+		begin = GallopUpperBound(begin, middle, *middle, lessThan);
+		if (begin == middle) {
+			return;
+		}
+
+		// The back of the right run that goes after the left run is also already in place
+		end = GallopLowerBound(middle, end, *(middle - 1), lessThan);
+
+		size_t leftSize = static_cast<size_t>(middle - begin);
+		if (workingArea.size() < leftSize) {
+			workingArea.resize(leftSize);
+		}
+		std::move(begin, middle, workingArea.begin());
+
+		auto left = workingArea.begin();
+		auto leftEnd = workingArea.begin() + leftSize;
+		IteratorType right = middle;
+		IteratorType output = begin;
+
+		// The output can never catch up with the right run since the left run was moved out of the way
+		while (left != leftEnd && right != end) {
+
+			// Merge one value at a time until one of the runs wins too many times in a row
+			size_t leftWins = 0;
+			size_t rightWins = 0;
+			while (left != leftEnd && right != end && leftWins < TIM_SORT_MINIMUM_GALLOP && rightWins < TIM_SORT_MINIMUM_GALLOP) {
+				if (lessThan(*right, *left)) {
+					*output = std::move(*right);
+					++right;
+					++rightWins;
+					leftWins = 0;
 				}
-				// if we've run out of the previous block, write all of the next block
-				else if (first == last) {
-					writeTarget[writeHead++] = readTarget[firstNext++];
+				else {
+					*output = std::move(*left);
+					++left;
+					++leftWins;
+					rightWins = 0;
 				}
-				// if the first is lower, that means we write that one and advance the write head
-				else if (readTarget[firstNext] < readTarget[first]) {
-					writeTarget[writeHead++] = readTarget[firstNext++];
+				++output;
+			}
+
+			// Gallop until the runs start interleaving again
+			while (left != leftEnd && right != end) {
+				auto leftStop = GallopUpperBound(left, leftEnd, *right, lessThan);
+				size_t leftCount = static_cast<size_t>(leftStop - left);
+				output = std::move(left, leftStop, output);
+				left = leftStop;
+				if (left == leftEnd) {
+					break;
 				}
-				else {
-					writeTarget[writeHead++] = readTarget[first++];
+
+				IteratorType rightStop = GallopLowerBound(right, end, *left, lessThan);
+				size_t rightCount = static_cast<size_t>(rightStop - right);
+				output = std::move(right, rightStop, output);
+				right = rightStop;
+
+				if (leftCount < TIM_SORT_MINIMUM_GALLOP && rightCount < TIM_SORT_MINIMUM_GALLOP) {
+					break;
 				}
 			}
 		}
 
-		// swap our read and write bodies and reset the write head
-		std::swap(writeTarget, readTarget);
-		writeHead = 0;
+		// What is left of the right run is already in place
+		std::move(left, leftEnd, output);
+	}
+
+	// Determine the minimum run size, this is a value in [32, 64] that splits the collection in close to a power of 2 amount of runs
+	inline size_t TimSortMinimumRun(size_t size) {
 
-		// Increase our block size by the current blockSize
-		blockSize += blockSize;
+		size_t remainder = 0;
+		while (size >= TIM_SORT_MINIMUM_MERGE) {
+			remainder |= size & 1;
+			size >>= 1;
+		}
+		return size + remainder;
 	}
+}
 
-	// Loop through the read target and write it to the passed in pointer
-	for (size_t i = 0; i < collectionSize; i++) {
-		begin[i] = readTarget[i];
+// Tim sort is an adaptive and stable merge sort, it finds the runs that are already sorted in the collection
+// and merges them together. It runs in O(n log(n)) time and gets close to O(n) when the collection is mostly sorted,
+// such as values that barely move from one frame to the next. It uses up to O(n) extra memory.
+// @Detail: descending runs are reversed in place, runs shorter than the minimum run size are extended with a binary insertion sort.
+//  The runs are kept on a fixed size stack and merged as soon as their sizes stop decreasing quickly enough,
+//  this keeps the merges balanced. A collection that is already sorted is a single run and never allocates.
+template< typename IteratorType, typename Comparator = Less, typename Projection = Identity >
+void TimSort(IteratorType begin, IteratorType end, Comparator comparator = Comparator(), Projection projection = Projection()) {
+
+	// Implementation:
+	// while there are values left
+	//	find the run that starts at the current value, reverse it if it's descending
+	//	extend it to the minimum run size with a binary insertion sort
+	//	push the run on the stack and merge the top runs until their sizes decrease quickly enough
+	// merge all of the runs left on the stack
+
+	struct SortedRun {
+		size_t m_Start;
+		size_t m_Size;
+	};
+
+	const auto lessThan = Detail::MakeProjectedLess(comparator, projection);
+	const size_t collectionSize = static_cast<size_t>(std::distance(begin, end));
+	if (collectionSize < 2) {
+		return;
+	}
+
+	const size_t minimumRun = Detail::TimSortMinimumRun(collectionSize);
+
+	SortedRun runs[Detail::TIM_SORT_STACK_SIZE];
+	size_t runCount = 0;
+	std::vector<typename std::iterator_traits<IteratorType>::value_type> workingArea;
+
+	// Merge the run at index with the run that follows it
+	auto mergeAt = [&](size_t index) {
+		SortedRun& left = runs[index];
+		SortedRun& right = runs[index + 1];
+		Detail::GallopingMerge(begin + left.m_Start, begin + right.m_Start, begin + (right.m_Start + right.m_Size), workingArea, lessThan);
+
+		left.m_Size += right.m_Size;
+		for (size_t i = index + 1; i < runCount - 1; i++) {
+			runs[i] = runs[i + 1];
+		}
+		--runCount;
+	};
+
+	size_t runStart = 0;
+	while (runStart < collectionSize) {
+
+		// Find the end of the run, a strictly descending run can be reversed without breaking the stability
+		size_t runEnd = runStart + 1;
+		if (runEnd < collectionSize) {
+			if (lessThan(begin[runEnd], begin[runEnd - 1])) {
+				while (runEnd < collectionSize && lessThan(begin[runEnd], begin[runEnd - 1])) {
+					++runEnd;
+				}
+				std::reverse(begin + runStart, begin + runEnd);
+			}
+			else {
+				while (runEnd < collectionSize && lessThan(begin[runEnd], begin[runEnd - 1]) == false) {
+					++runEnd;
+				}
+			}
+		}
+
+		// Short runs are extended with an insertion sort, this avoids merging many tiny runs
+		if (runEnd - runStart < minimumRun) {
+			size_t extendedEnd = Detail::Min(runStart + minimumRun, collectionSize);
+			Detail::BinaryInsertionSortRange(begin + runStart, begin + runEnd, begin + extendedEnd, lessThan);
+			runEnd = extendedEnd;
+		}
+
+		MIST_ASSERT(runCount < Detail::TIM_SORT_STACK_SIZE);
+		runs[runCount++] = { runStart, runEnd - runStart };
+		runStart = runEnd;
+
+		// Merge the runs at the top of the stack until every run is larger than the two runs above it
+		while (runCount > 1) {
+			size_t index = runCount - 2;
+			if ((index > 0 && runs[index - 1].m_Size <= runs[index].m_Size + runs[index + 1].m_Size)
+				|| (index > 1 && runs[index - 2].m_Size <= runs[index - 1].m_Size + runs[index].m_Size)) {
+				// Merge the smaller neighbour into the middle run
+				if (runs[index - 1].m_Size < runs[index + 1].m_Size) {
+					--index;
+				}
+			}
+			else if (runs[index].m_Size > runs[index + 1].m_Size) {
+				break;
+			}
+			mergeAt(index);
+		}
+	}
+
+	// Merge the runs that are left from the top of the stack down
+	while (runCount > 1) {
+		size_t index = runCount - 2;
+		if (index > 0 && runs[index - 1].m_Size < runs[index + 1].m_Size) {
+			--index;
+		}
+		mergeAt(index);
 	}
 }
 
+// This version of tim sort simply pipes the arguments to the iterator version of tim sort.
+// This version exists to match up with the merge sort interface.
+template< typename CollectionType, typename Comparator = Less, typename Projection = Identity,
+	// @Template condition: the collection must be iterable, this keeps pointer ranges on the iterator version
+	typename TemplateCondition = decltype(std::begin(std::declval<CollectionType&>()))>
+void TimSort(CollectionType* collection, Comparator comparator = Comparator(), Projection projection = Projection()) {
+	TimSort(collection->begin(), collection->end(), comparator, projection);
+}
+
 
 
 // -Quick Sort-
 
-// The main implementation of quick sort will be an in place quick sort. The implementation takes a
-// begin and end iterator in order to sort the items in place.
-template< typename IteratorType >
-void QuickSort(IteratorType begin, IteratorType end) {
+namespace Detail {
+	// Below this size, ranges are sorted with an insertion sort which is faster on small ranges
+	constexpr size_t QUICK_SORT_INSERTION_THRESHOLD = 16;
+	// Above this size, the pivot is selected with a ninther instead of a median of three
+	constexpr size_t QUICK_SORT_NINTHER_THRESHOLD = 128;
+	// The maximum amount of pending ranges, the larger range is always deferred which keeps the amount under log2(n)
+	constexpr size_t QUICK_SORT_STACK_SIZE = 64;
+
+	// Move the root of the heap down until both of it's children are lower than it
+	template< typename IteratorType, typename LessThan >
+	void SiftDown(IteratorType begin, size_t root, size_t heapSize, const LessThan& lessThan) {
+
+		typename std::iterator_traits<IteratorType>::value_type value = std::move(begin[root]);
+		size_t child = root * 2 + 1;
+		while (child < heapSize) {
+			// Select the largest child
+			if (child + 1 < heapSize && lessThan(begin[child], begin[child + 1])) {
+				++child;
+			}
+			if (lessThan(value, begin[child]) == false) {
+				break;
+			}
 
-	// Implementation:
-	// push a start and end range for the sort into a queue
-	// Pick the first range of the queue
-	// pick the last element of the range as the pivot
-	// go through every item from the start to the end
-	// keep in place if the item is greater than the pivot
-	// swap with the first greater if the item is lower than the pivot if there is a first greater item
-	// push the right range and the left range into the queue if their size is greater than one
-
-
-	// Create the queue and push the intial range
-	std::stack<std::pair<IteratorType, IteratorType>> sortingRanges;
-	sortingRanges.push(std::make_pair(begin, end));
-
-	// keep looping until the queue has been emptied
-	while (sortingRanges.empty() == false) {
-		// Get the most recent range and remove it
-		std::pair<IteratorType, IteratorType> currentRange = sortingRanges.top();
-		sortingRanges.pop();
-
-		// Grab a pivot in the range from the back
-		IteratorType pivot = currentRange.second - 1;
-		IteratorType compareTarget = currentRange.first;
-		
-		// Initialize the first largest to the pivot to assure that we don't have a first largest as a smaller element
-		IteratorType firstLargest = pivot;
+			begin[root] = std::move(begin[child]);
+			root = child;
+			child = root * 2 + 1;
+		}
+		begin[root] = std::move(value);
+	}
+
+	// Turn the range into a max heap
+	template< typename IteratorType, typename LessThan >
+	void MakeHeap(IteratorType begin, IteratorType end, const LessThan& lessThan) {
 
-		// Compare the target with the pivot
-		// If the current target is smaller than the pivot, swap it with the first largest
-		// If the current target is larger than the pivot, leave it in place
-		for (; compareTarget != currentRange.second; ++compareTarget) {
-			// Swap them if they aren't the same
-			if (*compareTarget <= *pivot && firstLargest != pivot && compareTarget != pivot) {
-				std::swap(*compareTarget, *firstLargest);
-				// move the first largest forward since it is now smaller
-				++firstLargest;
+		size_t size = static_cast<size_t>(end - begin);
+		for (size_t root = size / 2; root > 0; --root) {
+			SiftDown(begin, root - 1, size, lessThan);
+		}
+	}
+
+	// Sort a range that is a max heap by moving the largest value to the back one at a time
+	template< typename IteratorType, typename LessThan >
+	void SortHeap(IteratorType begin, IteratorType end, const LessThan& lessThan) {
+
+		size_t size = static_cast<size_t>(end - begin);
+		for (size_t heapSize = size; heapSize > 1; --heapSize) {
+			std::swap(begin[0], begin[heapSize - 1]);
+			SiftDown(begin, 0, heapSize - 1, lessThan);
+		}
+	}
+
+	// Order three values so that first <= second <= third
+	template< typename IteratorType, typename LessThan >
+	void SortThree(IteratorType first, IteratorType second, IteratorType third, const LessThan& lessThan) {
+
+		if (lessThan(*second, *first)) {
+			std::swap(*first, *second);
+		}
+		if (lessThan(*third, *second)) {
+			std::swap(*second, *third);
+			if (lessThan(*second, *first)) {
+				std::swap(*first, *second);
+			}
+		}
+	}
+
+	// Select a pivot with a median of three, or a ninther on large ranges, and move it to the front of the range
+	template< typename IteratorType, typename LessThan >
+	void MovePivotToFront(IteratorType begin, IteratorType end, const LessThan& lessThan) {
+
+		size_t size = static_cast<size_t>(end - begin);
+		size_t half = size / 2;
+		if (size > QUICK_SORT_NINTHER_THRESHOLD) {
+			// Take the median of the medians of three groups of three
+			SortThree(begin, begin + half, end - 1, lessThan);
+			SortThree(begin + 1, begin + (half - 1), end - 2, lessThan);
+			SortThree(begin + 2, begin + (half + 1), end - 3, lessThan);
+			SortThree(begin + (half - 1), begin + half, begin + (half + 1), lessThan);
+			std::swap(*begin, *(begin + half));
+		}
+		else {
+			// The median ends up in the middle iterator which is the front of the range
+			SortThree(begin + half, begin, end - 1, lessThan);
+		}
+	}
+
+	// Partition the range around the pivot at the front of the range, returns the final position of the pivot
+	// @Detail: values equal to the pivot are swapped to both sides, this keeps the partitions balanced
+	//  when the range has a lot of duplicates
+	template< typename IteratorType, typename LessThan >
+	IteratorType PartitionAroundFront(IteratorType begin, IteratorType end, const LessThan& lessThan) {
+
+		IteratorType left = begin + 1;
+		IteratorType right = end - 1;
+		while (true) {
+			while (left <= right && lessThan(*left, *begin)) {
+				++left;
+			}
+			while (left <= right && lessThan(*begin, *right)) {
+				--right;
 			}
-			// If the compare target is larger than the pivot and we don't have a first largest yet,
-			// track it as our first largest
-			else if (*compareTarget > *pivot && firstLargest == pivot) {
-				firstLargest = compareTarget;
+			if (left >= right) {
+				break;
 			}
+
+			std::swap(*left, *right);
+			++left;
+			--right;
 		}
 
-		// Swap our values and set our new pivot position
-		std::swap(*firstLargest, *pivot);
-		pivot = firstLargest;
+		// Right is the last value that isn't greater than the pivot
+		std::swap(*begin, *right);
+		return right;
+	}
+}
 
-		// Once the pivots and the ranges have been created, add the new ranges to the queue
-		
-		// if the right range is larger than one, add it to the queue
-		if (std::distance(pivot + 1, currentRange.second) > 1) {
-			sortingRanges.push(std::make_pair(pivot + 1, currentRange.second));
+// The main implementation of quick sort is an in place introsort. The implementation takes a
+// begin and end iterator in order to sort the items in place.
+// @Detail: the pivot is a median of three (or a ninther on large ranges) which avoids the quadratic
+//  behaviour on sorted and reverse sorted inputs, small ranges are finished with an insertion sort (or a vectorized sorting network
+//  for int32_t, uint64_t and float values in the default order) and
+//  ranges that recurse deeper than 2 * log2(n) fall back to a heap sort to guarantee O(n log(n)).
+//  The pending ranges are kept in a fixed size array on the stack, nothing is allocated.
+template< typename IteratorType, typename Comparator = Less, typename Projection = Identity >
+void QuickSort(IteratorType begin, IteratorType end, Comparator comparator = Comparator(), Projection projection = Projection()) {
+
+	// Implementation:
+	// push the whole range into the pending ranges
+	// pop a range and while it's larger than the insertion threshold:
+	//	if we've run out of depth, heap sort the range instead
+	//	move the pivot to the front of the range and partition the range around it
+	//	defer the larger partition and keep going with the smaller one
+	// insertion sort what is left of the range
+
+	struct SortingRange {
+		IteratorType m_Begin;
+		IteratorType m_End;
+		size_t m_DepthLeft;
+	};
+
+	const auto lessThan = Detail::MakeProjectedLess(comparator, projection);
+
+	size_t size = static_cast<size_t>(std::distance(begin, end));
+	if (size < 2) {
+		return;
+	}
+
+	// Allow 2 * log2(n) levels of partitioning before falling back to heap sort
+	size_t depthLimit = 0;
+	for (size_t i = size; i > 1; i >>= 1) {
+		depthLimit += 2;
+	}
+
+	SortingRange sortingRanges[Detail::QUICK_SORT_STACK_SIZE];
+	size_t rangeCount = 0;
+	sortingRanges[rangeCount++] = { begin, end, depthLimit };
+
+	// keep looping until the stack has been emptied
+	while (rangeCount > 0) {
+		SortingRange currentRange = sortingRanges[--rangeCount];
+
+		bool isSorted = false;
+		while (static_cast<size_t>(currentRange.m_End - currentRange.m_Begin) > Detail::QUICK_SORT_INSERTION_THRESHOLD) {
+
+			// The pivots have been bad for too long, heap sort is slower but doesn't degrade
+			if (currentRange.m_DepthLeft == 0) {
+				Detail::MakeHeap(currentRange.m_Begin, currentRange.m_End, lessThan);
+				Detail::SortHeap(currentRange.m_Begin, currentRange.m_End, lessThan);
+				isSorted = true;
+				break;
+			}
+			--currentRange.m_DepthLeft;
+
+			Detail::MovePivotToFront(currentRange.m_Begin, currentRange.m_End, lessThan);
+			IteratorType pivot = Detail::PartitionAroundFront(currentRange.m_Begin, currentRange.m_End, lessThan);
+
+			// Defer the larger range and keep going with the smaller one, this bounds the size of the stack
+			MIST_ASSERT(rangeCount < Detail::QUICK_SORT_STACK_SIZE);
+			if (pivot - currentRange.m_Begin < currentRange.m_End - (pivot + 1)) {
+				sortingRanges[rangeCount++] = { pivot + 1, currentRange.m_End, currentRange.m_DepthLeft };
+				currentRange.m_End = pivot;
+			}
+			else {
+				sortingRanges[rangeCount++] = { currentRange.m_Begin, pivot, currentRange.m_DepthLeft };
+				currentRange.m_Begin = pivot + 1;
+			}
 		}
 
-		// If the left range is larger than one, add it to the queue
-		if (std::distance(currentRange.first, pivot) > 1) {
-			sortingRanges.push(std::make_pair(currentRange.first, pivot));
+		if (isSorted == false) {
+			Detail::SmallSortRange<false>(currentRange.m_Begin, currentRange.m_End, lessThan);
 		}
 	}
 }
 
 // This version of quick sort simply pipes the arguments to the iterator version of quick sort.
 // This version exists to match up with the merge sort interface.
-template< typename CollectionType >
-void QuickSort(CollectionType* collection) {
-	QuickSort(collection->begin(), collection->end());
+template< typename CollectionType, typename Comparator = Less, typename Projection = Identity,
+	// @Template condition: the collection must be iterable, this keeps pointer ranges on the iterator version
+	typename TemplateCondition = decltype(std::begin(std::declval<CollectionType&>()))>
+void QuickSort(CollectionType* collection, Comparator comparator = Comparator(), Projection projection = Projection()) {
+	QuickSort(collection->begin(), collection->end(), comparator, projection);
+}
+
+
+
+// -Heap Sort-
+
+// Heap sort turns the range into a max heap and then moves the largest value to the back of the range one at a time.
+// It runs in O(n log(n)) time in every case and doesn't use any extra memory, the sort isn't stable.
+template< typename IteratorType, typename Comparator = Less, typename Projection = Identity >
+void HeapSort(IteratorType begin, IteratorType end, Comparator comparator = Comparator(), Projection projection = Projection()) {
+
+	const auto lessThan = Detail::MakeProjectedLess(comparator, projection);
+	Detail::MakeHeap(begin, end, lessThan);
+	Detail::SortHeap(begin, end, lessThan);
+}
+
+// This version of heap sort simply pipes the arguments to the iterator version of heap sort.
+// This version exists to match up with the merge sort interface.
+template< typename CollectionType, typename Comparator = Less, typename Projection = Identity,
+	// @Template condition: the collection must be iterable, this keeps pointer ranges on the iterator version
+	typename TemplateCondition = decltype(std::begin(std::declval<CollectionType&>()))>
+void HeapSort(CollectionType* collection, Comparator comparator = Comparator(), Projection projection = Projection()) {
+	HeapSort(collection->begin(), collection->end(), comparator, projection);
+}
+
+// Partial sort places the lowest middle - begin values of the range in sorted order in [begin, middle),
+// the rest of the values are left in [middle, end) in no particular order. This is the top k of the range.
+// @Detail: [begin, middle) is kept as a max heap of the lowest values seen so far, every other value replaces the
+//  top of the heap if it's lower. This runs in O(n log(k)) time and doesn't use any extra memory.
+template< typename IteratorType, typename Comparator = Less, typename Projection = Identity >
+void PartialSort(IteratorType begin, IteratorType middle, IteratorType end, Comparator comparator = Comparator(), Projection projection = Projection()) {
+
+	MIST_ASSERT(begin <= middle && middle <= end);
+
+	const auto lessThan = Detail::MakeProjectedLess(comparator, projection);
+	const size_t heapSize = static_cast<size_t>(middle - begin);
+	if (heapSize == 0) {
+		return;
+	}
+
+	Detail::MakeHeap(begin, middle, lessThan);
+	for (IteratorType current = middle; current != end; ++current) {
+		if (lessThan(*current, *begin)) {
+			std::swap(*current, *begin);
+			Detail::SiftDown(begin, 0, heapSize, lessThan);
+		}
+	}
+	Detail::SortHeap(begin, middle, lessThan);
+}
+
+// Nth element places the value that would be at nth if the range was sorted at nth, every value before it
+// isn't greater than it and every value after it isn't lower than it. This is also known as a selection.
+// @Detail: the implementation is an introselect, it partitions the range like QuickSort but only keeps going with the side
+//  that contains nth which runs in O(n) on average. If the partitions go too deep, it falls back to a partial sort.
+template< typename IteratorType, typename Comparator = Less, typename Projection = Identity >
+void NthElement(IteratorType begin, IteratorType nth, IteratorType end, Comparator comparator = Comparator(), Projection projection = Projection()) {
+
+	MIST_ASSERT(begin <= nth && nth <= end);
+	if (nth == end) {
+		return;
+	}
+
+	const auto lessThan = Detail::MakeProjectedLess(comparator, projection);
+
+	// Allow 2 * log2(n) levels of partitioning before falling back to the partial sort
+	size_t depthLeft = 0;
+	for (size_t i = static_cast<size_t>(end - begin); i > 1; i >>= 1) {
+		depthLeft += 2;
+	}
+
+	while (static_cast<size_t>(end - begin) > Detail::QUICK_SORT_INSERTION_THRESHOLD) {
+
+		if (depthLeft == 0) {
+			PartialSort(begin, nth + 1, end, comparator, projection);
+			return;
+		}
+		--depthLeft;
+
+		Detail::MovePivotToFront(begin, end, lessThan);
+		IteratorType pivot = Detail::PartitionAroundFront(begin, end, lessThan);
+		if (pivot == nth) {
+			return;
+		}
+		else if (nth < pivot) {
+			end = pivot;
+		}
+		else {
+			begin = pivot + 1;
+		}
+	}
+
+	Detail::InsertionSortRange(begin, end, lessThan);
 }
 
 
 
 // -Insertion Sort-
 
-// This implementation of insertion sort requires that the destination collection be sorted ahead of time
-// If the destination has random access, a binary search will be executed on the destination collection
-// in order to minimize the amount of comparisons
+namespace Detail {
+	// Retrieve the size of a collection, this supports both the std containers and the Mist containers
+	template< typename CollectionType >
+	auto CollectionSize(const CollectionType& collection, int /*PreferStd*/) -> decltype(collection.size()) {
+		return collection.size();
+	}
+
+	template< typename CollectionType >
+	auto CollectionSize(const CollectionType& collection, long /*PreferStd*/) -> decltype(collection.Size()) {
+		return collection.Size();
+	}
+
+	// Resize a collection, this supports both the std containers and the Mist containers
+	template< typename CollectionType >
+	auto ResizeCollection(CollectionType& collection, size_t size, int /*PreferStd*/) -> decltype(collection.resize(size)) {
+		return collection.resize(size);
+	}
+
+	template< typename CollectionType >
+	auto ResizeCollection(CollectionType& collection, size_t size, long /*PreferStd*/) -> decltype(collection.Resize(size)) {
+		return collection.Resize(size);
+	}
+}
+
+// This implementation of insertion sort requires that the destination collection be sorted ahead of time.
+// The source values are inserted as a single batch, the batch is sorted and then merged into the destination
+// from the back in place. This moves every value of the destination at most once, O(n + m log(m)) instead of the
+// O(n * m) moves of inserting the values one by one.
+// The destination can be a std container with size and resize or a Mist container with Size and Resize, such as the DynamicArray.
+// The inserted values go before the values of the destination that are equal to them.
 template< typename SourceCollectionType, typename DestinationCollectionType = SourceCollectionType,
 	// @Template Condition: the destination collection must have a random access operator in order to
-	//  use the binary version of insertion soth
-	typename ValueType = decltype(std::declval<DestinationCollectionType>()[0]) >
-void InsertionSort(SourceCollectionType&& source, DestinationCollectionType* destination) {
-	
+	//  merge the values in place
+	typename ValueType = decltype(std::declval<DestinationCollectionType>()[0]),
+	typename Comparator = Less, typename Projection = Identity >
+void InsertionSort(SourceCollectionType&& source, DestinationCollectionType* destination, Comparator comparator = Comparator(), Projection projection = Projection()) {
+
 	// Implementation:
-	// Loop through all of the source collection elements
-	// Determine a start and end range for the destination collection
-	// Pick the middle element as the pivot and determine if the current insertion element is above the pivot
-	// If it was above, create a new range from pivot + 1 to end of the current range
-	// If it was below create a new range from start to pivot
-	// Once a collection of size 1 is reached, determine if the element we want to insert is above or below and insert it there
-
-	// Pseudo Code:
-	// for each element in source
-	//	define range as start -> end of destination
-	//	while the size of the range is over 1
-	//		select the middle element of the range
-	//		if the current element is above the pivot
-	//			transform the range to be pivot + 1 -> end
-	//		else if the current element is less or equal to the pivot
-	//			transform the range to be start -> pivot
-	//		Note: we could test for equality and if the element is the same as the pivot insert it now
-	//	Once the range is of size 1
-	//	If the element is larget than the start element, insert it after
-	//	If the element is less than or equal to the start element, insert it before
-
-	// The destination collection must be larger than 0
-	MIST_ASSERT(destination->size() > 0);
+	// Copy the source values into a batch and stable sort the batch
+	// Grow the destination once to fit the batch
+	// Merge from the back of both the batch and the destination into the back of the grown destination
+	// Once the batch is empty, the rest of the destination is already in place
+
+	using BatchValueType = typename std::decay<ValueType>::type;
+
+	const size_t destinationSize = Detail::CollectionSize(*destination, 0);
 	// The destination collection must be sorted before inserting into it
-	MIST_ASSERT(IsSorted(std::begin(*destination), std::end(*destination)));
+	MIST_ASSERT(destinationSize == 0 || IsSorted(std::begin(*destination), std::end(*destination), comparator, projection));
 
-	for (const auto& element : source) {
-		size_t start = 0;
-		size_t end = destination->size();
+	std::vector<BatchValueType> batch(std::begin(source), std::end(source));
+	if (batch.empty()) {
+		return;
+	}
+	MergeSort(batch.data(), batch.data() + batch.size(), comparator, projection);
+
+	Detail::ResizeCollection(*destination, destinationSize + batch.size(), 0);
+
+	const auto lessThan = Detail::MakeProjectedLess(comparator, projection);
+	size_t writeIndex = destinationSize + batch.size();
+	size_t destinationIndex = destinationSize;
+	size_t batchIndex = batch.size();
+	while (batchIndex > 0) {
+		// The destination value goes last if it isn't lower than the batch value
+		if (destinationIndex > 0 && lessThan((*destination)[destinationIndex - 1], batch[batchIndex - 1]) == false) {
+			(*destination)[--writeIndex] = std::move((*destination)[--destinationIndex]);
+		}
+		else {
+			(*destination)[--writeIndex] = std::move(batch[--batchIndex]);
+		}
+	}
+}
+
+// -Sorted Runs Merge-
+
+namespace Detail {
+	// A tournament tree that keeps track of which of k sources has the lowest value, the tree keeps the loser
+	// of every match in it's nodes and the overall winner at the root. When the winner's source advances,
+	// only the matches on the path from it's leaf to the root are replayed, this takes log2(k) comparisons.
+	// @Detail: beats(left, right) must determine if the current value of the source left goes before
+	//  the current value of the source right, exhausted sources must lose every match.
+	class LoserTree {
 
-		while (end - start > 1) {
+	public:
 
-			// Integer division is OK here, truncation is fine.
-			// We substract one from the end in order to assure that when we compare 3 elements
-			// that the end doesn't transform back into itself
-			size_t pivotIndex = start + (end - 1 - start) / 2;
-			const auto& pivot = (*destination)[pivotIndex];
+		// -Public API-
 
-			if (element > pivot) {
-				start = pivotIndex + 1;
-				// @Note: end is implied to remain the same, such as end = end 
+		// Play every match of the tournament between the sources
+		template< typename Beats >
+		void Build(size_t sourceCount, const Beats& beats) {
+
+			MIST_ASSERT(sourceCount > 0);
+			m_SourceCount = sourceCount;
+			m_Nodes.resize(sourceCount);
+
+			// The winners of the matches, the sources are the leaves at [sourceCount, 2 * sourceCount)
+			std::vector<size_t> winners(sourceCount * 2);
+			for (size_t i = 0; i < sourceCount; ++i) {
+				winners[sourceCount + i] = i;
 			}
-			else {
-				end = pivotIndex + 1;
-				// @Note: start is implied to remain the same such as start = start
+
+			for (size_t node = sourceCount - 1; node > 0; --node) {
+				size_t left = winners[node * 2];
+				size_t right = winners[node * 2 + 1];
+				bool leftWins = beats(left, right);
+				winners[node] = leftWins ? left : right;
+				m_Nodes[node] = leftWins ? right : left;
+			}
+
+			m_Nodes[0] = sourceCount > 1 ? winners[1] : 0;
+		}
+
+		// Replay the matches of the winner once it's source has advanced
+		template< typename Beats >
+		void ReplayWinner(const Beats& beats) {
+
+			size_t winner = m_Nodes[0];
+			for (size_t node = (winner + m_SourceCount) / 2; node > 0; node /= 2) {
+				if (beats(m_Nodes[node], winner)) {
+					std::swap(m_Nodes[node], winner);
+				}
 			}
+			m_Nodes[0] = winner;
+		}
 
-			// The range should never be able to reach a size of 0
-			MIST_ASSERT(end - start >= 1);
+		// Retrieve the source that currently has the lowest value
+		size_t Winner() const {
+			return m_Nodes[0];
 		}
 
-		size_t pivotIndex = start + (end - start) / 2;
-		const auto& pivot = (*destination)[pivotIndex];
-		if (element > pivot) {
-			destination->insert(std::begin(*destination) + pivotIndex + 1, element);
+	private:
+
+		// The overall winner is stored in the first node, the losers of the matches are stored in the other nodes
+		std::vector<size_t> m_Nodes;
+		size_t m_SourceCount = 0;
+	};
+
+	// A sorted range of values, the begin moves forward as the values are merged
+	template< typename IteratorType >
+	struct SortedRun {
+		IteratorType m_Begin;
+		IteratorType m_End;
+	};
+
+	// Determine how many values of all of the runs are merged before the value at position in run,
+	// equal values are merged in the order of their runs
+	template< typename IteratorType, typename LessThan >
+	size_t SortedRunsRank(const std::vector<SortedRun<IteratorType>>& runs, size_t run, IteratorType position, const LessThan& lessThan) {
+
+		size_t rank = static_cast<size_t>(std::distance(runs[run].m_Begin, position));
+		for (size_t i = 0; i < runs.size(); ++i) {
+			if (i < run) {
+				rank += static_cast<size_t>(std::distance(runs[i].m_Begin, std::upper_bound(runs[i].m_Begin, runs[i].m_End, *position, lessThan)));
+			}
+			else if (i > run) {
+				rank += static_cast<size_t>(std::distance(runs[i].m_Begin, std::lower_bound(runs[i].m_Begin, runs[i].m_End, *position, lessThan)));
+			}
 		}
-		else {
-			destination->insert(std::begin(*destination) + pivotIndex, element);
+		return rank;
+	}
+
+	// Find where every run is split so that the values before the splits are the first outputIndex values of the merge.
+	// @Detail: the value that ends up at outputIndex is found with a binary search of it's rank in every run,
+	//  the other runs are then split around that value. This takes O(k^2 * log2(n)^2) comparisons for k runs.
+	template< typename IteratorType, typename LessThan >
+	void SplitSortedRuns(const std::vector<SortedRun<IteratorType>>& runs, size_t outputIndex, IteratorType* splits, const LessThan& lessThan) {
+
+		for (size_t run = 0; run < runs.size(); ++run) {
+			// Find the first value of the run that isn't merged before outputIndex
+			size_t low = 0;
+			size_t high = static_cast<size_t>(std::distance(runs[run].m_Begin, runs[run].m_End));
+			while (low < high) {
+				size_t middle = low + (high - low) / 2;
+				if (SortedRunsRank(runs, run, runs[run].m_Begin + middle, lessThan) < outputIndex) {
+					low = middle + 1;
+				}
+				else {
+					high = middle;
+				}
+			}
+
+			if (runs[run].m_Begin + low == runs[run].m_End || SortedRunsRank(runs, run, runs[run].m_Begin + low, lessThan) != outputIndex) {
+				continue;
+			}
+
+			const auto& splitValue = *(runs[run].m_Begin + low);
+			for (size_t i = 0; i < runs.size(); ++i) {
+				if (i < run) {
+					splits[i] = std::upper_bound(runs[i].m_Begin, runs[i].m_End, splitValue, lessThan);
+				}
+				else if (i > run) {
+					splits[i] = std::lower_bound(runs[i].m_Begin, runs[i].m_End, splitValue, lessThan);
+				}
+			}
+			splits[run] = runs[run].m_Begin + low;
+			return;
+		}
+
+		// No value ends up at outputIndex, the split is past the end of every run
+		for (size_t i = 0; i < runs.size(); ++i) {
+			splits[i] = runs[i].m_End;
+		}
+	}
+}
+
+// Merges k sorted runs together with a loser tree, every value takes log2(k) comparisons.
+// The output is produced in chunks of any size, which allows the merge to stream into a fixed size buffer.
+// Equal values are merged in the order that their runs were added, which keeps the merge stable.
+// @Detail: the values are copied to the output, use std::move_iterator runs to move them instead.
+// @Example: merge the sorted results of every worker in chunks of 1024 values
+//
+//		SortedRunMerger<const int*> merger;
+//		for (const auto& result : workerResults) {
+//			merger.AddRun(result.data(), result.data() + result.size());
+//		}
+//		int chunk[1024];
+//		while (size_t count = merger.Merge(chunk, 1024)) {
+//			Consume(chunk, count);
+//		}
+template< typename IteratorType, typename Comparator = Less, typename Projection = Identity >
+class SortedRunMerger {
+
+public:
+
+	// -Public API-
+
+	// Add a sorted run to the merge, every run must be added before the first merge
+	void AddRun(IteratorType begin, IteratorType end) {
+
+		MIST_ASSERT(m_HasStarted == false);
+		MIST_ASSERT(begin == end || IsSorted(begin, end, m_LessThan.m_Comparator, m_LessThan.m_Projection));
+		m_Runs.push_back({ begin, end });
+	}
+
+	// Merge up to maxCount of the next values into the output, returns the amount of values written.
+	// Once every run is merged, nothing is written and 0 is returned.
+	template< typename OutputIterator >
+	size_t Merge(OutputIterator output, size_t maxCount) {
+
+		if (m_Runs.empty()) {
+			return 0;
+		}
+
+		auto beats = [this](size_t left, size_t right) { return Beats(left, right); };
+		if (m_HasStarted == false) {
+			m_Tree.Build(m_Runs.size(), beats);
+			m_HasStarted = true;
+		}
+
+		size_t writeCount = 0;
+		while (writeCount < maxCount) {
+			Detail::SortedRun<IteratorType>& winner = m_Runs[m_Tree.Winner()];
+			if (winner.m_Begin == winner.m_End) {
+				break;
+			}
+
+			*output = *winner.m_Begin;
+			++output;
+			++winner.m_Begin;
+			++writeCount;
+			m_Tree.ReplayWinner(beats);
+		}
+		return writeCount;
+	}
+
+	// Determine if every value of every run has been merged
+	bool IsDone() const {
+
+		for (const auto& run : m_Runs) {
+			if (run.m_Begin != run.m_End) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// -Structors-
+
+	SortedRunMerger(Comparator comparator = Comparator(), Projection projection = Projection())
+		: m_LessThan(Detail::MakeProjectedLess(comparator, projection)) {}
+
+private:
+
+	// -Implementation-
+
+	// Determine if the next value of the left run goes before the next value of the right run
+	bool Beats(size_t left, size_t right) const {
+
+		const Detail::SortedRun<IteratorType>& leftRun = m_Runs[left];
+		const Detail::SortedRun<IteratorType>& rightRun = m_Runs[right];
+		if (leftRun.m_Begin == leftRun.m_End) {
+			return false;
+		}
+		if (rightRun.m_Begin == rightRun.m_End) {
+			return true;
+		}
+		if (m_LessThan(*rightRun.m_Begin, *leftRun.m_Begin)) {
+			return false;
+		}
+		return m_LessThan(*leftRun.m_Begin, *rightRun.m_Begin) || left < right;
+	}
+
+	std::vector<Detail::SortedRun<IteratorType>> m_Runs;
+	Detail::LoserTree m_Tree;
+	Detail::ProjectedLess<Comparator, Projection> m_LessThan;
+	bool m_HasStarted = false;
+};
+
+// Merge a collection of sorted runs into the output, a run is any collection with a begin and an end such as a std::vector.
+// This keeps the order that the runs already have, instead of concatenating them and sorting them all over again.
+// Equal values are merged in the order of their runs. To merge in chunks, use the SortedRunMerger.
+template< typename RunCollectionType, typename OutputIterator, typename Comparator = Less, typename Projection = Identity,
+	// @Template condition: the runs must be a collection of collections
+	typename TemplateCondition = decltype(std::begin(*std::begin(std::declval<const RunCollectionType&>())))>
+void MergeSortedRuns(const RunCollectionType& runs, OutputIterator output, Comparator comparator = Comparator(), Projection projection = Projection()) {
+
+	using RunIterator = decltype(std::begin(*std::begin(runs)));
+
+	SortedRunMerger<RunIterator, Comparator, Projection> merger(comparator, projection);
+	for (const auto& run : runs) {
+		merger.AddRun(std::begin(run), std::end(run));
+	}
+	merger.Merge(output, static_cast<size_t>(-1));
+}
+
+// -Arg Sort-
+
+namespace Detail {
+	// The key of a value with the index of the value, this is what an argsort actually sorts
+	template< typename KeyType, typename IndexType >
+	struct KeyIndex {
+		KeyType m_Key;
+		IndexType m_Index;
+	};
+
+	// Move the values of the cycle that starts at start into place, the value at i goes to the position that lists it.
+	template< typename IteratorType, typename IndexType >
+	void PermuteCycle(IteratorType values, const IndexType* order, size_t start) {
+
+		auto startValue = std::move(values[start]);
+		size_t current = start;
+		for (size_t next = static_cast<size_t>(order[start]); next != start; next = static_cast<size_t>(order[next])) {
+			values[current] = std::move(values[next]);
+			current = next;
+		}
+		values[current] = std::move(startValue);
+	}
+}
+
+// Determine the order of the values without moving them, order[i] is the index of the value that goes at position i.
+// Only the keys and their indices are sorted, which is much cheaper than sorting large values that have to be moved around
+// with all of their payload. The order can then be applied to the values, and to any array parallel to them, with ApplyPermutation.
+// The order is stable, equal values keep their relative order.
+// @Detail: the key of a value is the result of the projection, a smaller IndexType such as uint32_t makes the sorted pairs smaller.
+template< typename IteratorType, typename IndexType, typename Comparator = Less, typename Projection = Identity >
+void ArgSort(IteratorType begin, IteratorType end, IndexType* order, Comparator comparator = Comparator(), Projection projection = Projection()) {
+
+	using KeyType = typename std::decay<decltype(projection(*begin))>::type;
+	using KeyIndexType = Detail::KeyIndex<KeyType, IndexType>;
+
+	const size_t collectionSize = static_cast<size_t>(std::distance(begin, end));
+	// Every index must fit in the index type
+	MIST_ASSERT(collectionSize == 0 || collectionSize - 1 <= static_cast<size_t>(std::numeric_limits<IndexType>::max()));
+
+	std::vector<KeyIndexType> keys;
+	keys.reserve(collectionSize);
+	for (IteratorType current = begin; current != end; ++current) {
+		keys.push_back({ projection(*current), static_cast<IndexType>(keys.size()) });
+	}
+
+	// Equal keys are ordered by their index, this keeps the order stable without the working area of a merge sort
+	QuickSort(keys.data(), keys.data() + keys.size(), [&comparator](const KeyIndexType& left, const KeyIndexType& right) {
+		return comparator(left.m_Key, right.m_Key) || (comparator(right.m_Key, left.m_Key) == false && left.m_Index < right.m_Index);
+	});
+
+	for (size_t i = 0; i < collectionSize; ++i) {
+		order[i] = keys[i].m_Index;
+	}
+}
+
+template< typename CollectionType, typename IndexType, typename Comparator = Less, typename Projection = Identity,
+	// @Template condition: the collection must be iterable
+	typename TemplateCondition = decltype(std::begin(std::declval<const CollectionType&>()))>
+void ArgSort(const CollectionType& collection, IndexType* order, Comparator comparator = Comparator(), Projection projection = Projection()) {
+	ArgSort(std::begin(collection), std::end(collection), order, comparator, projection);
+}
+
+// Reorder the arrays in place so that the value at order[i] ends up at position i, such as the order returned by ArgSort.
+// Any amount of arrays can be reordered at once, this applies the same order to every array of a structure of arrays.
+// @Detail: the permutation is split into it's cycles and every value is moved once along it's cycle,
+//  a single temporary value per array is needed. The order is left untouched, the visited values are tracked with one bit each.
+template< typename IndexType, typename... IteratorTypes >
+void ApplyPermutation(const IndexType* order, size_t count, IteratorTypes... arrays) {
+
+	std::vector<bool> isPlaced(count, false);
+	for (size_t start = 0; start < count; ++start) {
+		if (isPlaced[start]) {
+			continue;
+		}
+
+		size_t current = start;
+		do {
+			MIST_ASSERT(static_cast<size_t>(order[current]) < count);
+			MIST_ASSERT(isPlaced[current] == false);
+			isPlaced[current] = true;
+			current = static_cast<size_t>(order[current]);
+		} while (current != start);
+
+		// Values that are already in place don't need to move
+		if (static_cast<size_t>(order[start]) != start) {
+			int expansion[] = { 0, (Detail::PermuteCycle(arrays, order, start), 0)... };
+			(void)expansion;
 		}
 	}
 }
 
 // -BucketSort-
 
+namespace Detail {
+	// Up to this many buckets, the counts of the bucket sort live on the stack instead of being allocated
+	constexpr size_t BUCKET_SORT_STACK_BUCKET_COUNT = 256;
+
+	// Stable counting sort of the values by their key into the output, counts must hold (max - min + 1) zeroed counts.
+	// @Detail: the counts are turned into the offsets of every bucket with a prefix sum, the values are then scattered
+	//  to their bucket in order which keeps the sort stable.
+	template< typename ValueType, typename KeyType, typename KeyExtractor >
+	void CountingScatter(ValueType* begin, ValueType* end, ValueType* output, const KeyType min, const KeyType max, KeyExtractor& keyExtractor, size_t* counts) {
+
+		const size_t bucketCount = static_cast<size_t>(max - min) + 1;
+		for (ValueType* current = begin; current != end; ++current) {
+
+			KeyType key = static_cast<KeyType>(keyExtractor(*current));
+			MIST_ASSERT(key >= min);
+			MIST_ASSERT(key <= max);
+
+			++counts[static_cast<size_t>(key - min)];
+		}
+
+		// Turn the counts into the offset of every bucket
+		size_t offset = 0;
+		for (size_t bucket = 0; bucket < bucketCount; ++bucket) {
+			size_t count = counts[bucket];
+			counts[bucket] = offset;
+			offset += count;
+		}
+
+		for (ValueType* current = begin; current != end; ++current) {
+			size_t bucket = static_cast<size_t>(static_cast<KeyType>(keyExtractor(*current)) - min);
+			output[counts[bucket]++] = std::move(*current);
+		}
+	}
+}
+
 // Bucket sort is simply a counting algorithm that counts the amount of a recuring value
 // and then reconstructs the list based on the count of those values. The sorting runs in O(2n) or O(n)
+// The values must be integers in the inclusive range [min, max].
 template< typename IteratorType, typename ValueType, typename CountType = size_t >
 void BucketSort(IteratorType begin, IteratorType end, const ValueType min, const ValueType max) {
 
-	MIST_ASSERT(max > min);
+	MIST_ASSERT(max >= min);
 
-	// Create the vector for the counting of the values
-	std::vector<CountType> counts(max - min);
-	counts.resize(max - min);
+	// Create the vector for the counting of the values, both min and max have a bucket
+	std::vector<CountType> counts(static_cast<size_t>(max - min) + 1);
 
 	for (IteratorType current = begin; current != end; ++current) {
 		
@@ -366,10 +1391,10 @@ void BucketSort(IteratorType begin, IteratorType end, const ValueType min, const
 		MIST_ASSERT(*current <= max);
 
 		// Increment the count
-		++counts[*current - min];
+		++counts[static_cast<size_t>(*current - min)];
 	}
 
-	// Rebuild the list
+	// Rebuild the list, every bucket is offset from the minimum
 	size_t currentIndex = 0;
 	for (IteratorType current = begin; current != end; ++current) {
 
@@ -377,17 +1402,209 @@ void BucketSort(IteratorType begin, IteratorType end, const ValueType min, const
 			++currentIndex;
 		}
 
-		(*current) = currentIndex;
+		(*current) = static_cast<typename std::iterator_traits<IteratorType>::value_type>(min + static_cast<ValueType>(currentIndex));
 		--counts[currentIndex];
 	}
 }
 
 // This version of bucket sort simply pipes the arguments to the iterator version of bucket sort.
 // This version exists to match up with the merge sort interface.
-template< typename CollectionType, typename ValueType, typename CountType = size_t >
+template< typename CollectionType, typename ValueType, typename CountType = size_t,
+	// @Template condition: the collection must be iterable, this keeps pointer ranges on the iterator version
+	typename TemplateCondition = decltype(std::begin(std::declval<CollectionType&>()))>
 void BucketSort(CollectionType* collection, const ValueType min, const ValueType max) {
 	BucketSort<decltype(collection->begin()), ValueType, CountType>(collection->begin(), collection->end(), min, max);
 }
 
+// This version of bucket sort sorts the values by a small integer key in the inclusive range [min, max],
+// such as a material id. The sort is stable and uses the working area provided by the caller, the working area must
+// hold at least end - begin values and it's content is left in an unspecified state.
+// @Detail: the values are scattered into the working area and moved back, this makes it O(n + k) where k is the amount of keys.
+template< typename ValueType, typename KeyType, typename KeyExtractor >
+void BucketSort(ValueType* begin, ValueType* end, ValueType* workingArea, const KeyType min, const KeyType max, KeyExtractor keyExtractor) {
+
+	MIST_ASSERT(max >= min);
+	MIST_ASSERT(workingArea != nullptr || begin == end);
+
+	const size_t bucketCount = static_cast<size_t>(max - min) + 1;
+
+	// Small key ranges are counted on the stack, this avoids an allocation per sort
+	size_t stackCounts[Detail::BUCKET_SORT_STACK_BUCKET_COUNT];
+	std::vector<size_t> allocatedCounts;
+	size_t* counts = stackCounts;
+	if (bucketCount <= Detail::BUCKET_SORT_STACK_BUCKET_COUNT) {
+		std::fill(stackCounts, stackCounts + bucketCount, 0);
+	}
+	else {
+		allocatedCounts.resize(bucketCount);
+		counts = allocatedCounts.data();
+	}
+
+	Detail::CountingScatter(begin, end, workingArea, min, max, keyExtractor, counts);
+	std::move(workingArea, workingArea + (end - begin), begin);
+}
+
+// This version of bucket sort allocates it's own working area
+template< typename ValueType, typename KeyType, typename KeyExtractor >
+void BucketSort(ValueType* begin, ValueType* end, const KeyType min, const KeyType max, KeyExtractor keyExtractor) {
+
+	std::vector<ValueType> workingArea(static_cast<size_t>(end - begin));
+	BucketSort(begin, end, workingArea.data(), min, max, keyExtractor);
+}
+
+// This version of bucket sort simply pipes the arguments to the pointer version of bucket sort.
+// This version exists to match up with the merge sort interface.
+template< typename CollectionType, typename KeyType, typename KeyExtractor,
+	// @Template condition: the collection must be iterable, this keeps pointer ranges on the pointer version
+	typename TemplateCondition = decltype(std::begin(std::declval<CollectionType&>()))>
+void BucketSort(CollectionType* collection, const KeyType min, const KeyType max, KeyExtractor keyExtractor) {
+	BucketSort(collection->data(), collection->data() + collection->size(), min, max, keyExtractor);
+}
+
+// -Radix Sort-
+
+namespace Detail {
+	// The radix sort handles the keys one byte at a time
+	constexpr size_t RADIX_BITS = 8;
+	constexpr size_t RADIX_BUCKET_COUNT = 1 << RADIX_BITS;
+
+	// Retrieve the unsigned integer type that has the same size as the key
+	template< size_t tSize >
+	struct RadixUnsigned;
+
+	template<> struct RadixUnsigned<1> { using Type = uint8_t; };
+	template<> struct RadixUnsigned<2> { using Type = uint16_t; };
+	template<> struct RadixUnsigned<4> { using Type = uint32_t; };
+	template<> struct RadixUnsigned<8> { using Type = uint64_t; };
+
+	// Convert an integer key to an unsigned key that sorts in the same order
+	template< typename KeyType >
+	typename RadixUnsigned<sizeof(KeyType)>::Type ToRadixKey(KeyType key, std::false_type /*IsFloatingPoint*/) {
+
+		using UnsignedType = typename RadixUnsigned<sizeof(KeyType)>::Type;
+		UnsignedType radixKey = static_cast<UnsignedType>(key);
+
+		// Flip the sign bit, this moves the negative values below the positive values
+		if (std::is_signed<KeyType>::value) {
+			radixKey ^= static_cast<UnsignedType>(UnsignedType(1) << (sizeof(KeyType) * 8 - 1));
+		}
+		return radixKey;
+	}
+
+	// Convert an IEEE floating point key to an unsigned key that sorts in the same order
+	// @Detail: positive values only need their sign bit set to be above the negative values,
+	//  negative values have all of their bits flipped since a larger magnitude means a lower value.
+	template< typename KeyType >
+	typename RadixUnsigned<sizeof(KeyType)>::Type ToRadixKey(KeyType key, std::true_type /*IsFloatingPoint*/) {
+
+		using UnsignedType = typename RadixUnsigned<sizeof(KeyType)>::Type;
+		UnsignedType radixKey;
+		memcpy(&radixKey, &key, sizeof(KeyType));
+
+		const UnsignedType signBit = static_cast<UnsignedType>(UnsignedType(1) << (sizeof(KeyType) * 8 - 1));
+		return (radixKey & signBit) != 0 ? static_cast<UnsignedType>(~radixKey) : static_cast<UnsignedType>(radixKey | signBit);
+	}
+
+	template< typename KeyType >
+	typename RadixUnsigned<sizeof(KeyType)>::Type ToRadixKey(KeyType key) {
+		return ToRadixKey(key, std::is_floating_point<KeyType>());
+	}
+}
+
+// Radix sort is a least significant digit sort that sorts the keys one byte at a time, every pass is a stable
+// counting sort on one of the bytes of the key. The sort runs in O(kn) time where k is the size of the key in bytes
+// and uses O(n) extra memory. The key is extracted from the values with the key extractor which allows sorting
+// structs by one of their fields, the key can be an unsigned integer, a signed integer or an IEEE float.
+// The sort is stable.
+// @Detail: the histograms of every pass are built in a single read of the values, the values are then moved back and
+//  forth between the collection and a working area. Passes where every key has the same byte are skipped entirely,
+//  which is common in the high bytes of small keys.
+// @Example: sorting draw calls by their sort key would look like:
+//
+//		RadixSort(drawCalls.data(), drawCalls.data() + drawCalls.size(), [](const DrawCall& drawCall) { return drawCall.m_SortKey; });
+template< typename ValueType, typename KeyExtractor >
+void RadixSort(ValueType* begin, ValueType* end, KeyExtractor keyExtractor) {
+
+	using KeyType = typename std::decay<decltype(keyExtractor(*begin))>::type;
+	static_assert(std::is_arithmetic<KeyType>::value, "Radix sort can only sort integer and floating point keys.");
+	static_assert(sizeof(KeyType) <= sizeof(uint64_t), "Radix sort only supports keys of up to 64 bits, long double keys are not supported.");
+
+	constexpr size_t PASS_COUNT = sizeof(KeyType) * 8 / Detail::RADIX_BITS;
+
+	const size_t collectionSize = static_cast<size_t>(end - begin);
+	if (collectionSize < 2) {
+		return;
+	}
+
+	// Count the bytes of every pass in a single read of the values
+	size_t counts[PASS_COUNT][Detail::RADIX_BUCKET_COUNT] = {};
+	for (ValueType* current = begin; current != end; ++current) {
+
+		auto radixKey = Detail::ToRadixKey(static_cast<KeyType>(keyExtractor(*current)));
+		for (size_t pass = 0; pass < PASS_COUNT; ++pass) {
+			++counts[pass][(radixKey >> (pass * Detail::RADIX_BITS)) & (Detail::RADIX_BUCKET_COUNT - 1)];
+		}
+	}
+
+	// The working area is only allocated once we know that a pass is needed
+	std::vector<ValueType> workingArea;
+	ValueType* readTarget = begin;
+	ValueType* writeTarget = nullptr;
+
+	for (size_t pass = 0; pass < PASS_COUNT; ++pass) {
+
+		const size_t shift = pass * Detail::RADIX_BITS;
+		size_t* passCounts = counts[pass];
+
+		// If every key has the same byte, the pass wouldn't move anything
+		auto firstKey = Detail::ToRadixKey(static_cast<KeyType>(keyExtractor(*readTarget)));
+		if (passCounts[(firstKey >> shift) & (Detail::RADIX_BUCKET_COUNT - 1)] == collectionSize) {
+			continue;
+		}
+
+		if (writeTarget == nullptr) {
+			workingArea.resize(collectionSize);
+			writeTarget = workingArea.data();
+		}
+
+		// Turn the counts into the offset of every bucket
+		size_t offset = 0;
+		for (size_t bucket = 0; bucket < Detail::RADIX_BUCKET_COUNT; ++bucket) {
+			size_t count = passCounts[bucket];
+			passCounts[bucket] = offset;
+			offset += count;
+		}
+
+		// Scatter the values into their buckets, reading in order keeps the pass stable
+		for (size_t i = 0; i < collectionSize; ++i) {
+
+			auto radixKey = Detail::ToRadixKey(static_cast<KeyType>(keyExtractor(readTarget[i])));
+			writeTarget[passCounts[(radixKey >> shift) & (Detail::RADIX_BUCKET_COUNT - 1)]++] = std::move(readTarget[i]);
+		}
+
+		std::swap(readTarget, writeTarget);
+	}
+
+	// Move the values back if the last pass wrote into the working area
+	if (readTarget != begin) {
+		std::move(readTarget, readTarget + collectionSize, begin);
+	}
+}
+
+// This version of radix sort uses the values themselves as the keys
+template< typename ValueType >
+void RadixSort(ValueType* begin, ValueType* end) {
+	RadixSort(begin, end, Identity());
+}
+
+// This version of radix sort simply pipes the arguments to the pointer version of radix sort.
+// This version exists to match up with the merge sort interface.
+template< typename CollectionType, typename KeyExtractor = Identity,
+	// @Template condition: the collection must be iterable, this keeps pointer ranges on the pointer version
+	typename TemplateCondition = decltype(std::begin(std::declval<CollectionType&>()))>
+void RadixSort(CollectionType* collection, KeyExtractor keyExtractor = KeyExtractor()) {
+	RadixSort(collection->data(), collection->data() + collection->size(), keyExtractor);
+}
+
 
 MIST_NAMESPACE_END
@@ -0,0 +1,363 @@
+#pragma once
+
+#include <Mist_Common/include/UtilityMacros.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+// The vector instructions used by the sorting networks are selected at compile time
+// from the instruction sets that the compiler is allowed to use.
+// @Detail: MSVC never defines the SSE4 macros, but /arch:AVX implies SSE4.1 and SSE4.2
+#if defined(__AVX2__)
+#define MIST_SORTING_NETWORK_AVX2 1
+#include <immintrin.h>
+#elif defined(__SSE4_1__) || (defined(_MSC_VER) && defined(__AVX__))
+#define MIST_SORTING_NETWORK_SSE4 1
+#include <smmintrin.h>
+#if defined(__SSE4_2__) || defined(_MSC_VER)
+#define MIST_SORTING_NETWORK_SSE42 1
+#include <nmmintrin.h>
+#endif
+#endif
+
+// This file implements sorting networks for small ranges of int32_t, uint64_t and float values.
+// A sorting network always executes the same compares and exchanges no matter the values, this makes it
+// branchless and allows it to sort multiple values per instruction with SSE4 or AVX2.
+// When neither is available, the same network is executed one value at a time, which is only useful for NetworkSort itself
+// as the sorts of Sorting.h keep their insertion sort in that case.
+MIST_NAMESPACE
+
+namespace Detail {
+	// The largest range that can be sorted with a sorting network
+	constexpr size_t SORTING_NETWORK_MAXIMUM_SIZE = 32;
+
+	// The value used to pad the network to it's full size, the padding always sorts to the back
+	template< typename ValueType >
+	ValueType NetworkPadding(std::false_type /*IsFloatingPoint*/) {
+		return std::numeric_limits<ValueType>::max();
+	}
+
+	template< typename ValueType >
+	ValueType NetworkPadding(std::true_type /*IsFloatingPoint*/) {
+		return std::numeric_limits<ValueType>::infinity();
+	}
+
+	// The lanes of a sorting network determine how many values are compared at once and how.
+	// Every implementation provides:
+	//	Vector: the type that holds LANE_COUNT values
+	//	Load, Store: move LANE_COUNT values in and out of a vector
+	//	Less(left, right): the mask of the lanes where left is lower than right
+	//	Select(mask, ifTrue, ifFalse): pick the lanes of ifTrue where the mask is set and the lanes of ifFalse otherwise
+	//	SwapLanes(vector, distance): exchange every lane with the lane at it's index xor distance
+	//	MaskFromBits(bits): the mask of the lanes whose bit is set
+	// @Detail: the exchanges always select whole values and never use min or max, this keeps both values when
+	//  they compare equal but are different, such as -0.0f and 0.0f.
+	template< typename ValueType >
+	struct ScalarNetworkLanes {
+		using Vector = ValueType;
+		using Mask = bool;
+		static constexpr size_t LANE_COUNT = 1;
+
+		static Vector Load(const ValueType* values) { return *values; }
+		static void Store(ValueType* values, Vector vector) { *values = vector; }
+		static Mask Less(Vector left, Vector right) { return left < right; }
+		static Vector Select(Mask mask, Vector ifTrue, Vector ifFalse) { return mask ? ifTrue : ifFalse; }
+		static Mask SelectMask(Mask mask, Mask ifTrue, Mask ifFalse) { return mask ? ifTrue : ifFalse; }
+		static Vector SwapLanes(Vector vector, size_t /*distance*/) { return vector; }
+		static Mask MaskFromBits(unsigned bits) { return bits != 0; }
+	};
+
+	// By default, every type is sorted one value at a time
+	template< typename ValueType >
+	struct NetworkLanes : ScalarNetworkLanes<ValueType> {};
+
+#if MIST_SORTING_NETWORK_AVX2
+
+	template<>
+	struct NetworkLanes<int32_t> {
+		using Vector = __m256i;
+		using Mask = __m256i;
+		static constexpr size_t LANE_COUNT = 8;
+
+		static Vector Load(const int32_t* values) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values)); }
+		static void Store(int32_t* values, Vector vector) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(values), vector); }
+		static Mask Less(Vector left, Vector right) { return _mm256_cmpgt_epi32(right, left); }
+		static Vector Select(Mask mask, Vector ifTrue, Vector ifFalse) { return _mm256_blendv_epi8(ifFalse, ifTrue, mask); }
+		static Mask SelectMask(Mask mask, Mask ifTrue, Mask ifFalse) { return _mm256_blendv_epi8(ifFalse, ifTrue, mask); }
+
+		static Vector SwapLanes(Vector vector, size_t distance) {
+			switch (distance) {
+			case 1: return _mm256_shuffle_epi32(vector, 0xB1);
+			case 2: return _mm256_shuffle_epi32(vector, 0x4E);
+			default: return _mm256_permute2x128_si256(vector, vector, 0x01);
+			}
+		}
+
+		static Mask MaskFromBits(unsigned bits) {
+			const __m256i laneBits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+			return _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(static_cast<int>(bits)), laneBits), laneBits);
+		}
+	};
+
+	template<>
+	struct NetworkLanes<float> {
+		using Vector = __m256;
+		using Mask = __m256;
+		static constexpr size_t LANE_COUNT = 8;
+
+		static Vector Load(const float* values) { return _mm256_loadu_ps(values); }
+		static void Store(float* values, Vector vector) { _mm256_storeu_ps(values, vector); }
+		static Mask Less(Vector left, Vector right) { return _mm256_cmp_ps(left, right, _CMP_LT_OQ); }
+		static Vector Select(Mask mask, Vector ifTrue, Vector ifFalse) { return _mm256_blendv_ps(ifFalse, ifTrue, mask); }
+		static Mask SelectMask(Mask mask, Mask ifTrue, Mask ifFalse) { return _mm256_blendv_ps(ifFalse, ifTrue, mask); }
+
+		static Vector SwapLanes(Vector vector, size_t distance) {
+			switch (distance) {
+			case 1: return _mm256_permute_ps(vector, 0xB1);
+			case 2: return _mm256_permute_ps(vector, 0x4E);
+			default: return _mm256_permute2f128_ps(vector, vector, 0x01);
+			}
+		}
+
+		static Mask MaskFromBits(unsigned bits) {
+			return _mm256_castsi256_ps(NetworkLanes<int32_t>::MaskFromBits(bits));
+		}
+	};
+
+	template<>
+	struct NetworkLanes<uint64_t> {
+		using Vector = __m256i;
+		using Mask = __m256i;
+		static constexpr size_t LANE_COUNT = 4;
+
+		static Vector Load(const uint64_t* values) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values)); }
+		static void Store(uint64_t* values, Vector vector) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(values), vector); }
+
+		// There is no unsigned 64 bit compare, flipping the sign bits turns the signed compare into an unsigned compare
+		static Mask Less(Vector left, Vector right) {
+			const __m256i signBit = _mm256_set1_epi64x(static_cast<long long>(0x8000000000000000ull));
+			return _mm256_cmpgt_epi64(_mm256_xor_si256(right, signBit), _mm256_xor_si256(left, signBit));
+		}
+
+		static Vector Select(Mask mask, Vector ifTrue, Vector ifFalse) { return _mm256_blendv_epi8(ifFalse, ifTrue, mask); }
+		static Mask SelectMask(Mask mask, Mask ifTrue, Mask ifFalse) { return _mm256_blendv_epi8(ifFalse, ifTrue, mask); }
+
+		static Vector SwapLanes(Vector vector, size_t distance) {
+			return distance == 1 ? _mm256_permute4x64_epi64(vector, 0xB1) : _mm256_permute4x64_epi64(vector, 0x4E);
+		}
+
+		static Mask MaskFromBits(unsigned bits) {
+			const __m256i laneBits = _mm256_setr_epi64x(1, 2, 4, 8);
+			return _mm256_cmpeq_epi64(_mm256_and_si256(_mm256_set1_epi64x(static_cast<long long>(bits)), laneBits), laneBits);
+		}
+	};
+
+#elif MIST_SORTING_NETWORK_SSE4
+
+	template<>
+	struct NetworkLanes<int32_t> {
+		using Vector = __m128i;
+		using Mask = __m128i;
+		static constexpr size_t LANE_COUNT = 4;
+
+		static Vector Load(const int32_t* values) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(values)); }
+		static void Store(int32_t* values, Vector vector) { _mm_storeu_si128(reinterpret_cast<__m128i*>(values), vector); }
+		static Mask Less(Vector left, Vector right) { return _mm_cmplt_epi32(left, right); }
+		static Vector Select(Mask mask, Vector ifTrue, Vector ifFalse) { return _mm_blendv_epi8(ifFalse, ifTrue, mask); }
+		static Mask SelectMask(Mask mask, Mask ifTrue, Mask ifFalse) { return _mm_blendv_epi8(ifFalse, ifTrue, mask); }
+
+		static Vector SwapLanes(Vector vector, size_t distance) {
+			return distance == 1 ? _mm_shuffle_epi32(vector, 0xB1) : _mm_shuffle_epi32(vector, 0x4E);
+		}
+
+		static Mask MaskFromBits(unsigned bits) {
+			const __m128i laneBits = _mm_setr_epi32(1, 2, 4, 8);
+			return _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(static_cast<int>(bits)), laneBits), laneBits);
+		}
+	};
+
+	template<>
+	struct NetworkLanes<float> {
+		using Vector = __m128;
+		using Mask = __m128;
+		static constexpr size_t LANE_COUNT = 4;
+
+		static Vector Load(const float* values) { return _mm_loadu_ps(values); }
+		static void Store(float* values, Vector vector) { _mm_storeu_ps(values, vector); }
+		static Mask Less(Vector left, Vector right) { return _mm_cmplt_ps(left, right); }
+		static Vector Select(Mask mask, Vector ifTrue, Vector ifFalse) { return _mm_blendv_ps(ifFalse, ifTrue, mask); }
+		static Mask SelectMask(Mask mask, Mask ifTrue, Mask ifFalse) { return _mm_blendv_ps(ifFalse, ifTrue, mask); }
+
+		static Vector SwapLanes(Vector vector, size_t distance) {
+			return distance == 1 ? _mm_shuffle_ps(vector, vector, 0xB1) : _mm_shuffle_ps(vector, vector, 0x4E);
+		}
+
+		static Mask MaskFromBits(unsigned bits) {
+			return _mm_castsi128_ps(NetworkLanes<int32_t>::MaskFromBits(bits));
+		}
+	};
+
+#if MIST_SORTING_NETWORK_SSE42
+
+	template<>
+	struct NetworkLanes<uint64_t> {
+		using Vector = __m128i;
+		using Mask = __m128i;
+		static constexpr size_t LANE_COUNT = 2;
+
+		static Vector Load(const uint64_t* values) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(values)); }
+		static void Store(uint64_t* values, Vector vector) { _mm_storeu_si128(reinterpret_cast<__m128i*>(values), vector); }
+
+		// There is no unsigned 64 bit compare, flipping the sign bits turns the signed compare into an unsigned compare
+		static Mask Less(Vector left, Vector right) {
+			const __m128i signBit = _mm_set1_epi64x(static_cast<long long>(0x8000000000000000ull));
+			return _mm_cmpgt_epi64(_mm_xor_si128(right, signBit), _mm_xor_si128(left, signBit));
+		}
+
+		static Vector Select(Mask mask, Vector ifTrue, Vector ifFalse) { return _mm_blendv_epi8(ifFalse, ifTrue, mask); }
+		static Mask SelectMask(Mask mask, Mask ifTrue, Mask ifFalse) { return _mm_blendv_epi8(ifFalse, ifTrue, mask); }
+		static Vector SwapLanes(Vector vector, size_t /*distance*/) { return _mm_shuffle_epi32(vector, 0x4E); }
+
+		static Mask MaskFromBits(unsigned bits) {
+			const __m128i laneBits = _mm_set_epi64x(2, 1);
+			return _mm_cmpeq_epi64(_mm_and_si128(_mm_set1_epi64x(static_cast<long long>(bits)), laneBits), laneBits);
+		}
+	};
+
+#endif
+
+#endif
+
+	// The bits of the lanes of a vector of up to 8 lanes whose index has the bit set
+	inline unsigned LanesWithBit(size_t bit) {
+
+		switch (bit) {
+		case 1: return 0xAA;
+		case 2: return 0xCC;
+		case 4: return 0xF0;
+		default: return 0x00;
+		}
+	}
+
+	// Order the values of two vectors lane by lane, low receives the lower values and high the higher values
+	template< typename Lanes >
+	void CompareExchange(typename Lanes::Vector& low, typename Lanes::Vector& high) {
+
+		auto isHighLower = Lanes::Less(high, low);
+		auto newLow = Lanes::Select(isHighLower, high, low);
+		high = Lanes::Select(isHighLower, low, high);
+		low = newLow;
+	}
+
+	// Order every lane of the vector with the lane at it's index xor distance, the lanes set in highLanes receive the higher value
+	template< typename Lanes >
+	typename Lanes::Vector CompareExchangeLanes(typename Lanes::Vector vector, size_t distance, unsigned highLanes) {
+
+		typename Lanes::Vector partner = Lanes::SwapLanes(vector, distance);
+		// The low lanes take their partner if it's lower, the high lanes take their partner if it's higher
+		auto takePartner = Lanes::SelectMask(Lanes::MaskFromBits(highLanes), Lanes::Less(vector, partner), Lanes::Less(partner, vector));
+		return Lanes::Select(takePartner, partner, vector);
+	}
+
+	// Sort the values with a bitonic sorting network of tSize values, the values are padded up to tSize.
+	// @Detail: the network compares the values at index i and i xor j and the direction of the comparison depends on
+	//  the bit k of i. When j is at least the lane count, whole vectors are compared together, otherwise the lanes
+	//  of a vector are compared with each other.
+	template< size_t tSize, typename ValueType >
+	void BitonicNetworkSort(ValueType* values, size_t count) {
+
+		using Lanes = NetworkLanes<ValueType>;
+		constexpr size_t LANE_COUNT = Lanes::LANE_COUNT;
+		constexpr size_t VECTOR_COUNT = tSize / LANE_COUNT;
+		static_assert(tSize % LANE_COUNT == 0, "The network must fill whole vectors.");
+		constexpr unsigned ALL_LANES = (1u << LANE_COUNT) - 1;
+
+		MIST_ASSERT(count <= tSize);
+
+		ValueType paddedValues[tSize];
+		memcpy(paddedValues, values, sizeof(ValueType) * count);
+		const ValueType padding = NetworkPadding<ValueType>(std::is_floating_point<ValueType>());
+		for (size_t i = count; i < tSize; ++i) {
+			paddedValues[i] = padding;
+		}
+
+		typename Lanes::Vector vectors[VECTOR_COUNT];
+		for (size_t i = 0; i < VECTOR_COUNT; ++i) {
+			vectors[i] = Lanes::Load(paddedValues + i * LANE_COUNT);
+		}
+
+		for (size_t k = 2; k <= tSize; k += k) {
+			for (size_t j = k / 2; j > 0; j /= 2) {
+
+				if (j >= LANE_COUNT) {
+					const size_t vectorDistance = j / LANE_COUNT;
+					for (size_t i = 0; i < VECTOR_COUNT; ++i) {
+						size_t partner = i ^ vectorDistance;
+						if (partner > i) {
+							bool isAscending = ((i * LANE_COUNT) & k) == 0;
+							if (isAscending) {
+								CompareExchange<Lanes>(vectors[i], vectors[partner]);
+							}
+							else {
+								CompareExchange<Lanes>(vectors[partner], vectors[i]);
+							}
+						}
+					}
+				}
+				else {
+					// The upper lane of every pair receives the higher value, unless the lanes are sorted in descending order
+					for (size_t i = 0; i < VECTOR_COUNT; ++i) {
+						unsigned descendingLanes = k < LANE_COUNT ? LanesWithBit(k) : (((i * LANE_COUNT) & k) != 0 ? ALL_LANES : 0u);
+						vectors[i] = CompareExchangeLanes<Lanes>(vectors[i], j, (LanesWithBit(j) ^ descendingLanes) & ALL_LANES);
+					}
+				}
+			}
+		}
+
+		for (size_t i = 0; i < VECTOR_COUNT; ++i) {
+			Lanes::Store(paddedValues + i * LANE_COUNT, vectors[i]);
+		}
+		memcpy(values, paddedValues, sizeof(ValueType) * count);
+	}
+
+	// Determine if the values have a sorting network
+	template< typename ValueType >
+	struct HasSortingNetwork : std::integral_constant<bool,
+		std::is_same<ValueType, int32_t>::value || std::is_same<ValueType, uint64_t>::value || std::is_same<ValueType, float>::value> {};
+
+	// Determine if the sorting network of the values compares multiple values per instruction
+	template< typename ValueType, bool tHasSortingNetwork = HasSortingNetwork<ValueType>::value >
+	struct HasVectorSortingNetwork : std::false_type {};
+
+	template< typename ValueType >
+	struct HasVectorSortingNetwork<ValueType, true> : std::integral_constant<bool, (NetworkLanes<ValueType>::LANE_COUNT > 1)> {};
+}
+
+// Sort a range of at most 32 int32_t, uint64_t or float values in ascending order with a sorting network.
+// The sort isn't stable, equal floats such as -0.0f and 0.0f might be swapped. NaNs are not supported.
+// @Detail: the network is picked from the sizes 8, 16 and 32, the values are padded with the largest value up to that size.
+template< typename ValueType >
+void NetworkSort(ValueType* begin, ValueType* end) {
+
+	static_assert(Detail::HasSortingNetwork<ValueType>::value, "Sorting networks only support int32_t, uint64_t and float.");
+
+	const size_t count = static_cast<size_t>(end - begin);
+	MIST_ASSERT(count <= Detail::SORTING_NETWORK_MAXIMUM_SIZE);
+
+	if (count < 2) {
+		return;
+	}
+	else if (count <= 8) {
+		Detail::BitonicNetworkSort<8>(begin, count);
+	}
+	else if (count <= 16) {
+		Detail::BitonicNetworkSort<16>(begin, count);
+	}
+	else {
+		Detail::BitonicNetworkSort<32>(begin, count);
+	}
+}
+
+MIST_NAMESPACE_END
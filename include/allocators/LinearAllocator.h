@@ -0,0 +1,420 @@
+#pragma once
+
+#include <Mist_Common/include/UtilityMacros.h>
+#include "CppAllocator.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <type_traits>
+
+MIST_NAMESPACE
+
+// A linear arena is a single block of memory that hands out allocations by bumping a pointer forward.
+// Individual frees don't return memory to the arena (except for the most recent allocation),
+// instead the whole arena is reset at once, typically at the end of a frame.
+// @Detail: every block is preceded by a small header with it's size in order to support Realloc,
+//  the most recent block can be grown or shrunk in place which keeps DynamicArray growth cheap.
+class LinearArena {
+
+public:
+
+	// -Public API-
+
+	template< typename Type, typename... Arguments >
+	Type* Alloc(Arguments&&... args);
+
+	// Allocate a block of size bytes aligned to the requested alignment
+	// returns nullptr if the arena has run out of space
+	inline void* Alloc(size_t size, size_t alignment = DEFAULT_ALIGNMENT);
+
+	// Call the destructor of the object, the memory is only reclaimed if it was the last allocation
+	template< typename Type,
+		// @Template condition, assure that you don't delete a void pointer,
+		// only allow the void pointer version of free to be used
+		typename TemplateCondition = typename std::enable_if<!std::is_same<void, Type>::value>::type >
+	void Free(Type* object);
+
+	// The memory is only reclaimed if it was the last allocation, otherwise it waits for Reset
+	inline void Free(void* block);
+
+	// Reallocate a block of memory, if the block is the last allocation it is resized in place
+	// otherwise a new block is allocated and the contents are copied over.
+	// newSize cannot be 0
+	inline void* Realloc(void* block, size_t newSize);
+
+	// Release every allocation in the arena at once.
+	// @Detail: destructors are not called, any objects still living in the arena are simply forgotten
+	inline void Reset();
+
+	inline size_t UsedSize() const;
+
+	inline size_t Capacity() const;
+
+	// -Structors-
+
+	// Create an arena that owns a block of arenaSize bytes
+	inline LinearArena(size_t arenaSize);
+
+	// Create an arena on top of memory owned by the user, the memory must outlive the arena
+	inline LinearArena(void* memory, size_t arenaSize);
+
+	inline ~LinearArena();
+
+	LinearArena(const LinearArena&) = delete;
+	LinearArena& operator=(const LinearArena&) = delete;
+
+	static constexpr size_t DEFAULT_ALIGNMENT = alignof(std::max_align_t);
+
+private:
+
+	// The header stored in front of every block
+	struct BlockHeader {
+		size_t m_Size;
+		// The top of the arena before this block was allocated, used to roll back the arena when freed
+		size_t m_PreviousTop;
+	};
+
+	// Retrieve the header stored in front of a block
+	inline BlockHeader* GetHeader(void* block);
+
+	char* m_Memory = nullptr;
+	size_t m_Capacity = 0;
+	// The offset of the next free byte in the arena
+	size_t m_Top = 0;
+	bool m_OwnsMemory = false;
+};
+
+
+// The linear allocator exposes a static linear arena through the same static interface as the CppAllocator
+// in order to be plugged into the allocator slot of the containers.
+// @Detail: every allocator with the same size and tag share the same arena, use different tags to
+//  create separate arenas. Reset releases everything allocated through this allocator.
+// @Example: per-frame scratch arrays would look like:
+//
+//		struct FrameTag {};
+//		using FrameAllocator = LinearAllocator<1024 * 1024, FrameTag>;
+//		DynamicArray<int, FrameAllocator> scratch;
+//		...
+//		FrameAllocator::Reset();
+template< size_t tArenaSize, typename Tag = void >
+class LinearAllocator {
+	static_assert(tArenaSize > 0, "A Linear Allocator cannot have an arena of size 0.");
+
+public:
+
+	template< typename Type, typename... Arguments >
+	static Type* Alloc(Arguments&&... args);
+
+	static void* Alloc(size_t size);
+
+	template< typename Type,
+		// @Template condition, assure that you don't delete a void pointer,
+		// only allow the void pointer version of free to be used
+		typename TemplateCondition = typename std::enable_if<!std::is_same<void, Type>::value>::type >
+	static void Free(Type* object);
+
+	static void Free(void* block);
+
+	static void* Realloc(void* block, size_t newSize);
+
+	// Release every allocation made through this allocator
+	static void Reset();
+
+	static size_t UsedSize();
+
+	static size_t Capacity();
+
+	// Retrieve the arena backing this allocator
+	static LinearArena& GetArena();
+};
+
+
+// The linear arena allocator is a stateful handle to a linear arena, this allows individual containers
+// to be pointed at their own arena such as a per-level or a per-thread arena.
+// @Detail: the handle doesn't own the arena, the arena must outlive every container that uses it.
+// @Example: a level array would look like:
+//
+//		LinearArena levelArena(1024 * 1024);
+//		LinearArenaAllocator levelAllocator(&levelArena);
+//		DynamicArray<int, LinearArenaAllocator> levelArray(levelAllocator);
+class LinearArenaAllocator {
+
+public:
+
+	template< typename Type, typename... Arguments >
+	Type* Alloc(Arguments&&... args);
+
+	inline void* Alloc(size_t size);
+
+	template< typename Type,
+		// @Template condition, assure that you don't delete a void pointer,
+		// only allow the void pointer version of free to be used
+		typename TemplateCondition = typename std::enable_if<!std::is_same<void, Type>::value>::type >
+	void Free(Type* object);
+
+	inline void Free(void* block);
+
+	inline void* Realloc(void* block, size_t newSize);
+
+	inline LinearArena* GetArena() const;
+
+	// -Structors-
+
+	inline LinearArenaAllocator(LinearArena* arena);
+
+private:
+
+	LinearArena* m_Arena = nullptr;
+};
+
+
+// -Implementation-
+
+// -LinearArena-
+
+template< typename Type, typename... Arguments >
+Type* LinearArena::Alloc(Arguments&&... args) {
+
+	void* block = Alloc(sizeof(Type), alignof(Type) > DEFAULT_ALIGNMENT ? alignof(Type) : DEFAULT_ALIGNMENT);
+	MIST_ASSERT(block != nullptr);
+
+	Type* object = new (block) Type(std::forward<Arguments>(args)...);
+	return object;
+}
+
+inline void* LinearArena::Alloc(size_t size, size_t alignment) {
+
+	MIST_ASSERT(size > 0);
+	// The alignment must be a power of 2
+	MIST_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+	// Leave room for the header in front of the block and align the block itself
+	uintptr_t top = reinterpret_cast<uintptr_t>(m_Memory) + m_Top + sizeof(BlockHeader);
+	uintptr_t blockAddress = (top + alignment - 1) & ~(uintptr_t)(alignment - 1);
+	size_t newTop = (size_t)(blockAddress - reinterpret_cast<uintptr_t>(m_Memory)) + size;
+
+	// The arena has run out of memory, it's probably time to increase it's size
+	if (newTop > m_Capacity) {
+		MIST_ASSERT(false);
+		return nullptr;
+	}
+
+	void* block = reinterpret_cast<void*>(blockAddress);
+	BlockHeader* header = GetHeader(block);
+	header->m_Size = size;
+	header->m_PreviousTop = m_Top;
+	m_Top = newTop;
+
+	return block;
+}
+
+template< typename Type, typename TemplateCondition >
+void LinearArena::Free(Type* object) {
+
+	MIST_ASSERT(object != nullptr);
+	object->~Type();
+	Free(static_cast<void*>(object));
+}
+
+inline void LinearArena::Free(void* block) {
+
+	MIST_ASSERT(block != nullptr);
+	MIST_ASSERT(block >= m_Memory && block < m_Memory + m_Capacity);
+
+	BlockHeader* header = GetHeader(block);
+	char* blockEnd = static_cast<char*>(block) + header->m_Size;
+	// If we're the last block, we can simply roll back the top of the arena
+	if (blockEnd == m_Memory + m_Top) {
+		m_Top = header->m_PreviousTop;
+	}
+}
+
+inline void* LinearArena::Realloc(void* block, size_t newSize) {
+
+	MIST_ASSERT(newSize > 0);
+
+	// If the old block has never existed,
+	if (block == nullptr) {
+		return Alloc(newSize);
+	}
+
+	MIST_ASSERT(block >= m_Memory && block < m_Memory + m_Capacity);
+
+	size_t& oldSize = GetHeader(block)->m_Size;
+	size_t blockOffset = (size_t)(static_cast<char*>(block) - m_Memory);
+
+	// If we're the last block, resize in place if there is enough room left
+	if (blockOffset + oldSize == m_Top) {
+		if (blockOffset + newSize <= m_Capacity) {
+			oldSize = newSize;
+			m_Top = blockOffset + newSize;
+			return block;
+		}
+		MIST_ASSERT(false);
+		return nullptr;
+	}
+
+	void* newBlock = Alloc(newSize);
+	if (newBlock == nullptr) {
+		return nullptr;
+	}
+
+	// Get the minimum size between the old size and the new size,
+	// this assures that we don't copy too much information into the block
+	size_t minSize = oldSize < newSize ? oldSize : newSize;
+	memcpy(newBlock, block, minSize);
+
+#if MIST_DEBUG
+	// set the old blocks memory to garbage
+	memset(block, 0xDB, oldSize);
+#endif
+
+	return newBlock;
+}
+
+inline void LinearArena::Reset() {
+
+#if MIST_DEBUG
+	// Scramble the released memory to assure that nothing keeps using it
+	memset(m_Memory, 0xDB, m_Top);
+#endif
+
+	m_Top = 0;
+}
+
+inline size_t LinearArena::UsedSize() const {
+
+	return m_Top;
+}
+
+inline size_t LinearArena::Capacity() const {
+
+	return m_Capacity;
+}
+
+inline LinearArena::BlockHeader* LinearArena::GetHeader(void* block) {
+
+	return reinterpret_cast<BlockHeader*>(static_cast<char*>(block) - sizeof(BlockHeader));
+}
+
+inline LinearArena::LinearArena(size_t arenaSize)
+	: m_Memory(static_cast<char*>(CppAllocator::Alloc(arenaSize))), m_Capacity(arenaSize), m_OwnsMemory(true) {
+
+	MIST_ASSERT(m_Memory != nullptr);
+}
+
+inline LinearArena::LinearArena(void* memory, size_t arenaSize)
+	: m_Memory(static_cast<char*>(memory)), m_Capacity(arenaSize), m_OwnsMemory(false) {
+
+	MIST_ASSERT(m_Memory != nullptr);
+	MIST_ASSERT(arenaSize > 0);
+}
+
+inline LinearArena::~LinearArena() {
+
+	if (m_OwnsMemory) {
+		CppAllocator::Free(static_cast<void*>(m_Memory));
+	}
+}
+
+// -LinearAllocator-
+
+template< size_t tArenaSize, typename Tag >
+template< typename Type, typename... Arguments >
+Type* LinearAllocator<tArenaSize, Tag>::Alloc(Arguments&&... args) {
+
+	return GetArena().template Alloc<Type>(std::forward<Arguments>(args)...);
+}
+
+template< size_t tArenaSize, typename Tag >
+void* LinearAllocator<tArenaSize, Tag>::Alloc(size_t size) {
+
+	return GetArena().Alloc(size);
+}
+
+template< size_t tArenaSize, typename Tag >
+template< typename Type, typename TemplateCondition >
+void LinearAllocator<tArenaSize, Tag>::Free(Type* object) {
+
+	GetArena().Free(object);
+}
+
+template< size_t tArenaSize, typename Tag >
+void LinearAllocator<tArenaSize, Tag>::Free(void* block) {
+
+	GetArena().Free(block);
+}
+
+template< size_t tArenaSize, typename Tag >
+void* LinearAllocator<tArenaSize, Tag>::Realloc(void* block, size_t newSize) {
+
+	return GetArena().Realloc(block, newSize);
+}
+
+template< size_t tArenaSize, typename Tag >
+void LinearAllocator<tArenaSize, Tag>::Reset() {
+
+	GetArena().Reset();
+}
+
+template< size_t tArenaSize, typename Tag >
+size_t LinearAllocator<tArenaSize, Tag>::UsedSize() {
+
+	return GetArena().UsedSize();
+}
+
+template< size_t tArenaSize, typename Tag >
+size_t LinearAllocator<tArenaSize, Tag>::Capacity() {
+
+	return GetArena().Capacity();
+}
+
+template< size_t tArenaSize, typename Tag >
+LinearArena& LinearAllocator<tArenaSize, Tag>::GetArena() {
+
+	// The arena is created the first time it's used and lives until the end of the program
+	static LinearArena arena(tArenaSize);
+	return arena;
+}
+
+// -LinearArenaAllocator-
+
+template< typename Type, typename... Arguments >
+Type* LinearArenaAllocator::Alloc(Arguments&&... args) {
+
+	return m_Arena->template Alloc<Type>(std::forward<Arguments>(args)...);
+}
+
+inline void* LinearArenaAllocator::Alloc(size_t size) {
+
+	return m_Arena->Alloc(size);
+}
+
+template< typename Type, typename TemplateCondition >
+void LinearArenaAllocator::Free(Type* object) {
+
+	m_Arena->Free(object);
+}
+
+inline void LinearArenaAllocator::Free(void* block) {
+
+	m_Arena->Free(block);
+}
+
+inline void* LinearArenaAllocator::Realloc(void* block, size_t newSize) {
+
+	return m_Arena->Realloc(block, newSize);
+}
+
+inline LinearArena* LinearArenaAllocator::GetArena() const {
+
+	return m_Arena;
+}
+
+inline LinearArenaAllocator::LinearArenaAllocator(LinearArena* arena) : m_Arena(arena) {
+
+	MIST_ASSERT(m_Arena != nullptr);
+}
+
+MIST_NAMESPACE_END
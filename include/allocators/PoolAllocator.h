@@ -0,0 +1,242 @@
+#pragma once
+
+#include <Mist_Common/include/UtilityMacros.h>
+#include "CppAllocator.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <type_traits>
+
+MIST_NAMESPACE
+
+// A pool arena hands out blocks of a single fixed size. The unused blocks are kept in a free list
+// threaded through the blocks themselves, allocation and free are simply a pop and a push on that list.
+// @Detail: when the free list runs out, a new chunk of blocksPerChunk blocks is allocated from the CppAllocator,
+//  chunks are only released when the arena is destroyed.
+class PoolArena {
+
+public:
+
+	// -Public API-
+
+	template< typename Type, typename... Arguments >
+	Type* Alloc(Arguments&&... args);
+
+	// Retrieve a single block from the pool, the block is BlockSize() bytes large
+	inline void* Alloc();
+
+	// Call the destructor of the object and return it's block to the pool
+	template< typename Type,
+		// @Template condition, assure that you don't delete a void pointer,
+		// only allow the void pointer version of free to be used
+		typename TemplateCondition = typename std::enable_if<!std::is_same<void, Type>::value>::type >
+	void Free(Type* object);
+
+	// Return a block to the pool, the block must have been allocated from this pool
+	inline void Free(void* block);
+
+	inline size_t BlockSize() const;
+
+	inline size_t ChunkCount() const;
+
+	// -Structors-
+
+	// Create a pool of blocks of at least blockSize bytes, aligned to alignment
+	// @Detail: no memory is allocated until the first call to Alloc
+	inline PoolArena(size_t blockSize, size_t blocksPerChunk, size_t alignment = alignof(std::max_align_t));
+
+	inline ~PoolArena();
+
+	PoolArena(const PoolArena&) = delete;
+	PoolArena& operator=(const PoolArena&) = delete;
+
+private:
+
+	// Allocate a new chunk and thread it's blocks into the free list
+	inline void AllocateChunk();
+
+	// The free blocks store the next free block in their first bytes
+	struct FreeBlock {
+		FreeBlock* m_Next;
+	};
+
+	// Every chunk starts with a link to the previously allocated chunk
+	struct Chunk {
+		Chunk* m_Next;
+	};
+
+	FreeBlock* m_FreeList = nullptr;
+	Chunk* m_Chunks = nullptr;
+	size_t m_ChunkCount = 0;
+
+	size_t m_BlockSize = 0;
+	size_t m_BlocksPerChunk = 0;
+	size_t m_Alignment = 0;
+};
+
+
+// The pool allocator exposes a pool arena per allocated type through the same static interface as the CppAllocator
+// in order to be plugged into the allocator slot of the containers.
+// @Detail: only typed allocations are supported as a pool can't resize a block, this makes it a good fit for
+//  node based containers such as the SingleList but not for the DynamicArray.
+// @Example: a list with pooled nodes would look like:
+//
+//		SingleList<int, PoolAllocator<>> list;
+//		list.InsertAsLast(10);
+template< size_t tBlocksPerChunk = 256, typename Tag = void >
+class PoolAllocator {
+	static_assert(tBlocksPerChunk > 0, "A Pool Allocator cannot have chunks of size 0.");
+
+public:
+
+	template< typename Type, typename... Arguments >
+	static Type* Alloc(Arguments&&... args);
+
+	template< typename Type,
+		// @Template condition, assure that you don't delete a void pointer
+		typename TemplateCondition = typename std::enable_if<!std::is_same<void, Type>::value>::type >
+	static void Free(Type* object);
+
+	// Retrieve the pool that serves the allocations of Type
+	template< typename Type >
+	static PoolArena& GetPool();
+};
+
+
+// -Implementation-
+
+// -PoolArena-
+
+template< typename Type, typename... Arguments >
+Type* PoolArena::Alloc(Arguments&&... args) {
+
+	// The type must fit in the blocks of the pool
+	MIST_ASSERT(sizeof(Type) <= m_BlockSize);
+	MIST_ASSERT(alignof(Type) <= m_Alignment);
+
+	Type* object = new (Alloc()) Type(std::forward<Arguments>(args)...);
+	return object;
+}
+
+inline void* PoolArena::Alloc() {
+
+	if (m_FreeList == nullptr) {
+		AllocateChunk();
+	}
+
+	// Pop the first block of the free list
+	FreeBlock* block = m_FreeList;
+	m_FreeList = block->m_Next;
+	return block;
+}
+
+template< typename Type, typename TemplateCondition >
+void PoolArena::Free(Type* object) {
+
+	MIST_ASSERT(object != nullptr);
+	object->~Type();
+	Free(static_cast<void*>(object));
+}
+
+inline void PoolArena::Free(void* block) {
+
+	MIST_ASSERT(block != nullptr);
+
+#if MIST_DEBUG
+	// Scramble the block to assure that it isn't reused
+	memset(block, 0xDB, m_BlockSize);
+#endif
+
+	// Push the block at the front of the free list
+	FreeBlock* freeBlock = static_cast<FreeBlock*>(block);
+	freeBlock->m_Next = m_FreeList;
+	m_FreeList = freeBlock;
+}
+
+inline size_t PoolArena::BlockSize() const {
+
+	return m_BlockSize;
+}
+
+inline size_t PoolArena::ChunkCount() const {
+
+	return m_ChunkCount;
+}
+
+inline void PoolArena::AllocateChunk() {
+
+	// Leave room for the chunk link and for aligning the first block
+	size_t chunkSize = sizeof(Chunk) + m_Alignment + m_BlockSize * m_BlocksPerChunk;
+	Chunk* chunk = static_cast<Chunk*>(CppAllocator::Alloc(chunkSize));
+	MIST_ASSERT(chunk != nullptr);
+
+	chunk->m_Next = m_Chunks;
+	m_Chunks = chunk;
+	m_ChunkCount++;
+
+	uintptr_t firstBlock = reinterpret_cast<uintptr_t>(chunk + 1);
+	firstBlock = (firstBlock + m_Alignment - 1) & ~(uintptr_t)(m_Alignment - 1);
+
+	// Thread the blocks in address order, this assures that consecutive allocations are next to each other in memory
+	char* blocks = reinterpret_cast<char*>(firstBlock);
+	for (size_t i = 0; i < m_BlocksPerChunk - 1; ++i) {
+		reinterpret_cast<FreeBlock*>(blocks + i * m_BlockSize)->m_Next = reinterpret_cast<FreeBlock*>(blocks + (i + 1) * m_BlockSize);
+	}
+	reinterpret_cast<FreeBlock*>(blocks + (m_BlocksPerChunk - 1) * m_BlockSize)->m_Next = m_FreeList;
+
+	m_FreeList = reinterpret_cast<FreeBlock*>(blocks);
+}
+
+inline PoolArena::PoolArena(size_t blockSize, size_t blocksPerChunk, size_t alignment)
+	: m_BlocksPerChunk(blocksPerChunk), m_Alignment(alignment) {
+
+	MIST_ASSERT(blockSize > 0);
+	MIST_ASSERT(blocksPerChunk > 0);
+	// The alignment must be a power of 2
+	MIST_ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+	// Every block must be able to hold the free list link and keep the next block aligned
+	if (m_Alignment < alignof(FreeBlock)) {
+		m_Alignment = alignof(FreeBlock);
+	}
+	m_BlockSize = blockSize < sizeof(FreeBlock) ? sizeof(FreeBlock) : blockSize;
+	m_BlockSize = (m_BlockSize + m_Alignment - 1) & ~(m_Alignment - 1);
+}
+
+inline PoolArena::~PoolArena() {
+
+	while (m_Chunks != nullptr) {
+
+		Chunk* nextChunk = m_Chunks->m_Next;
+		CppAllocator::Free(static_cast<void*>(m_Chunks));
+		m_Chunks = nextChunk;
+	}
+}
+
+// -PoolAllocator-
+
+template< size_t tBlocksPerChunk, typename Tag >
+template< typename Type, typename... Arguments >
+Type* PoolAllocator<tBlocksPerChunk, Tag>::Alloc(Arguments&&... args) {
+
+	return GetPool<Type>().template Alloc<Type>(std::forward<Arguments>(args)...);
+}
+
+template< size_t tBlocksPerChunk, typename Tag >
+template< typename Type, typename TemplateCondition >
+void PoolAllocator<tBlocksPerChunk, Tag>::Free(Type* object) {
+
+	GetPool<Type>().Free(object);
+}
+
+template< size_t tBlocksPerChunk, typename Tag >
+template< typename Type >
+PoolArena& PoolAllocator<tBlocksPerChunk, Tag>::GetPool() {
+
+	// The pool is created the first time it's used and lives until the end of the program
+	static PoolArena pool(sizeof(Type), tBlocksPerChunk, alignof(Type));
+	return pool;
+}
+
+MIST_NAMESPACE_END
@@ -3,12 +3,45 @@
 #include <Mist_Common/include/UtilityMacros.h>
 #include "../allocators/CppAllocator.h"
 #include <cstdint>
+#include <cstring>
+#include <iterator>
 #include <type_traits>
 
 MIST_NAMESPACE
 
-template< typename ValueType, typename Allocator = CppAllocator >
-class DynamicArray {
+// -Growth Policies-
+// A growth policy determines the new capacity of the array once it runs out of space.
+// Any type that is default constructible and implements:
+//		size_t operator()(size_t currentCapacity, size_t requiredCapacity) const;
+// can be used as a growth policy, the returned capacity must be at least requiredCapacity.
+
+// Grow the capacity by a factor of tNumerator / tDenominator, this makes N insertions cost O(N) copies
+template< size_t tNumerator, size_t tDenominator >
+struct GeometricGrowthPolicy {
+	static_assert(tNumerator > tDenominator, "A geometric growth policy must grow by a factor larger than 1.");
+
+	// The capacity of the first allocation, this avoids a series of tiny allocations on an empty array
+	static constexpr size_t MINIMUM_CAPACITY = 4;
+
+	size_t operator()(size_t currentCapacity, size_t requiredCapacity) const;
+};
+
+using DoubleGrowthPolicy = GeometricGrowthPolicy<2, 1>;
+using OneAndHalfGrowthPolicy = GeometricGrowthPolicy<3, 2>;
+
+// Grow the capacity by a fixed amount of elements, this wastes less memory but makes N insertions cost O(N^2) copies
+template< size_t tStep >
+struct FixedGrowthPolicy {
+	static_assert(tStep > 0, "A fixed growth policy must grow by at least one element.");
+
+	size_t operator()(size_t currentCapacity, size_t requiredCapacity) const;
+};
+
+
+// @Detail: the allocator is stored as a private base, this assures that stateless allocators such as the
+//  CppAllocator don't add anything to the size of the array while stateful allocators can be passed in the constructors.
+template< typename ValueType, typename Allocator = CppAllocator, typename GrowthPolicy = DoubleGrowthPolicy >
+class DynamicArray : private Allocator {
 
 public:
 
@@ -18,10 +51,24 @@ public:
 	template< typename... WriteType >
 	void InsertAsLast(WriteType&&... writeValue);
 
+	// Write a range of values into the array at the back, the memory is reserved once for the whole range
+	// @Detail: if the range is a pointer range of a trivially copyable type, the values are copied in a single memcpy.
+	//  A pointer range can be part of the array itself, other iterators must not point into the array.
+	template< typename IteratorType >
+	void InsertRange(IteratorType rangeBegin, IteratorType rangeEnd);
+
+	// Grow the array by count elements without initializing them and return a pointer to the first new element
+	// @Detail: only trivially copyable types are allowed, the new elements hold garbage until they are written to
+	ValueType* AppendUninitialized(size_t count);
+
 	// Remove the last element of the array.
 	// @Detail: the array will not shrink
 	void RemoveLast();
 
+	// Remove the last count elements of the array.
+	// @Detail: the array will not shrink, trivially destructible types are removed in O(1)
+	void RemoveLast(size_t count);
+
 	// Shrink the array to the desired size
 	// @Detail: This shrinks the allocated memory to fit sizeof(ValueType) * Size() with no extra room
 	void ShrinkToSize();
@@ -29,6 +76,7 @@ public:
 	// Resize the array to fit the desired size
 	// @Detail: This might remove some elements from the array
 	//  a size of zero is disallowed, call clear instead if you intend to empty the array
+	//  The memory is reserved once and trivial types are filled with memset or memcpy instead of one element at a time
 	template< typename... WriteValues >
 	void Resize(size_t desiredSize, WriteValues&&... defaultValue);
 
@@ -56,10 +104,17 @@ public:
 
 	size_t ReservedSize() const;
 
+	// Retrieve the allocator used by the array
+	Allocator& GetAllocator();
+
 	// Remove the contents of the array, this completely removes
 	// everything in the array and references to those items will be lost
 	void Clear();
 
+	// Remove the contents of the array but keep the reserved memory for the next use of the array
+	// @Detail: trivially destructible types are removed in O(1)
+	void ClearKeepCapacity();
+
 	// -Iterators-
 
 	ValueType* begin();
@@ -68,10 +123,14 @@ public:
 	// -Structors-
 
 	DynamicArray() = default;
+
+	// Create a dynamic array that allocates it's memory from the allocator passed in
+	explicit DynamicArray(const Allocator& allocator);
+
 	// Create a dynamic array with the desired reserved space, you cannot invoke
 	// operator[] as no elements were pushed into the array
 	// @Detail: Internally, this just invokes ReserveAdditional.
-	DynamicArray(size_t desiredReservedSpace);
+	DynamicArray(size_t desiredReservedSpace, const Allocator& allocator = Allocator());
 
 	~DynamicArray();
 
@@ -86,7 +145,45 @@ public:
 
 private:
 
-	static constexpr size_t GROWTH_BLOCK_SIZE = 5;
+	// Grow the reserved memory according to the growth policy in order to fit at least requiredCapacity elements
+	void GrowToFit(size_t requiredCapacity);
+
+	// Assure that the array can hold at least requiredCapacity elements, growing according to the growth policy
+	void EnsureCapacity(size_t requiredCapacity);
+
+	// Construct count copies of a value at the back of the array, the memory must already be reserved
+	// @Detail: trivially copyable values are constructed once and then copied with memcpy
+	template< typename... WriteValues >
+	void FillAsLast(size_t count, std::true_type isTriviallyCopyable, WriteValues&&... writeValues);
+
+	template< typename... WriteValues >
+	void FillAsLast(size_t count, std::false_type isTriviallyCopyable, WriteValues&&... writeValues);
+
+	// Construct the count new elements of a resize at the back of the array, the memory must already be reserved
+	// @Detail: value initialized trivial types are zeroed with a single memset
+	void ResizeFillAsLast(size_t count, std::true_type isZeroFill);
+
+	template< typename... WriteValues >
+	void ResizeFillAsLast(size_t count, std::false_type isZeroFill, WriteValues&&... writeValues);
+
+	// Copy count elements from the range at the back of the array, the memory must already be reserved
+	template< typename IteratorType >
+	void CopyAsLast(IteratorType rangeBegin, size_t count, std::true_type isMemoryCopyable);
+
+	template< typename IteratorType >
+	void CopyAsLast(IteratorType rangeBegin, size_t count, std::false_type isMemoryCopyable);
+
+	// Determine the index of the element that the pointer points to, m_ItemCount if it doesn't point into the array
+	template< typename IteratorType >
+	size_t IndexInArray(IteratorType iterator, std::true_type isValuePointer) const;
+
+	template< typename IteratorType >
+	size_t IndexInArray(IteratorType iterator, std::false_type isValuePointer) const;
+
+	// Destroy the last count elements of the array, trivially destructible types don't need to visit every element
+	void DestroyLast(size_t count, std::true_type isTriviallyDestructible);
+
+	void DestroyLast(size_t count, std::false_type isTriviallyDestructible);
 
 	void* m_Memory = nullptr;
 	size_t m_ItemCount = 0;
@@ -95,10 +192,34 @@ private:
 
 // -Implementation-
 
+// -Growth Policies-
 
-template< typename ValueType, typename Allocator >
+template< size_t tNumerator, size_t tDenominator >
+size_t GeometricGrowthPolicy<tNumerator, tDenominator>::operator()(size_t currentCapacity, size_t requiredCapacity) const {
+
+	// Past this capacity, growing by the factor would overflow
+	if (currentCapacity > SIZE_MAX / tNumerator) {
+		return requiredCapacity;
+	}
+
+	size_t newCapacity = currentCapacity * tNumerator / tDenominator;
+	newCapacity = newCapacity < MINIMUM_CAPACITY ? MINIMUM_CAPACITY : newCapacity;
+	return newCapacity < requiredCapacity ? requiredCapacity : newCapacity;
+}
+
+template< size_t tStep >
+size_t FixedGrowthPolicy<tStep>::operator()(size_t currentCapacity, size_t requiredCapacity) const {
+
+	size_t newCapacity = currentCapacity + tStep;
+	return newCapacity < requiredCapacity ? requiredCapacity : newCapacity;
+}
+
+// -DynamicArray-
+
+
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
 template< typename... WriteType >
-void DynamicArray<ValueType, Allocator>::InsertAsLast(WriteType&&... writeValue) {
+void DynamicArray<ValueType, Allocator, GrowthPolicy>::InsertAsLast(WriteType&&... writeValue) {
 
 #if MIST_DEBUG
 	size_t previousMemorySize = m_MemorySize;
@@ -106,7 +227,7 @@ void DynamicArray<ValueType, Allocator>::InsertAsLast(WriteType&&... writeValue)
 
 	// Assure that we have enough space
 	if (m_MemorySize < (m_ItemCount + 1) * sizeof(ValueType)) {
-		ReserveAdditional(GROWTH_BLOCK_SIZE);
+		GrowToFit(m_ItemCount + 1);
 		
 #if MIST_DEBUG
 		/// Assure that the memory size actually grew after calling ReserveAdditional
@@ -130,36 +251,79 @@ void DynamicArray<ValueType, Allocator>::InsertAsLast(WriteType&&... writeValue)
 	m_ItemCount++;
 }
 
-template< typename ValueType, typename Allocator >
-void DynamicArray<ValueType, Allocator>::RemoveLast() {
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+template< typename IteratorType >
+void DynamicArray<ValueType, Allocator, GrowthPolicy>::InsertRange(IteratorType rangeBegin, IteratorType rangeEnd) {
 
-	// Decrement our item count and call the destructor on the last item
-	ValueType* lastItem = LastValue();
-	lastItem->ValueType::~ValueType();
+	size_t count = static_cast<size_t>(std::distance(rangeBegin, rangeEnd));
+	if (count == 0) {
+		return;
+	}
 
-	m_ItemCount--;
+	using IteratorValueType = typename std::iterator_traits<IteratorType>::value_type;
+	using IsValuePointer = std::integral_constant<bool, std::is_pointer<IteratorType>::value && std::is_same<IteratorValueType, ValueType>::value>;
+	// Raw pointers to trivially copyable values can be copied as a single block of memory
+	using IsMemoryCopyable = std::integral_constant<bool, IsValuePointer::value && std::is_trivially_copyable<ValueType>::value>;
 
-#if MIST_DEBUG
-	// Scramble the item to assure that it isn't reused and assure that we crash the program
-	memset(lastItem, 0xDB, sizeof(ValueType));
-#endif
+	// Growing moves the values of the array, a range inside of the array is found again by it's index
+	size_t rangeIndex = IndexInArray(rangeBegin, IsValuePointer());
+	MIST_ASSERT(rangeIndex == m_ItemCount || rangeIndex + count <= m_ItemCount);
+
+	EnsureCapacity(m_ItemCount + count);
+
+	if (rangeIndex < m_ItemCount) {
+		CopyAsLast(AsRawArray() + rangeIndex, count, std::integral_constant<bool, std::is_trivially_copyable<ValueType>::value>());
+	}
+	else {
+		CopyAsLast(rangeBegin, count, IsMemoryCopyable());
+	}
+}
+
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+ValueType* DynamicArray<ValueType, Allocator, GrowthPolicy>::AppendUninitialized(size_t count) {
+
+	static_assert(std::is_trivially_copyable<ValueType>::value, "Only trivially copyable types can be left uninitialized.");
+	MIST_ASSERT(count > 0);
+
+	EnsureCapacity(m_ItemCount + count);
+
+	ValueType* firstNewItem = AsRawArray() + m_ItemCount;
+	m_ItemCount += count;
+	return firstNewItem;
 }
 
-template< typename ValueType, typename Allocator >
-void DynamicArray<ValueType, Allocator>::ShrinkToSize() {
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+void DynamicArray<ValueType, Allocator, GrowthPolicy>::RemoveLast() {
+
+	RemoveLast(1);
+}
+
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+void DynamicArray<ValueType, Allocator, GrowthPolicy>::RemoveLast(size_t count) {
+
+	MIST_ASSERT(count <= m_ItemCount);
+	if (count == 0) {
+		return;
+	}
+
+	DestroyLast(count, typename std::is_trivially_destructible<ValueType>::type());
+}
+
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+void DynamicArray<ValueType, Allocator, GrowthPolicy>::ShrinkToSize() {
 
 	// If we're already the right size, don't do anything, this is to avoid doing extra work
 	if (m_MemorySize == m_ItemCount * sizeof(ValueType)) {
 		return;
 	}
 
-	m_Memory = Allocator::template Realloc(m_Memory, m_ItemCount * sizeof(ValueType));
+	m_Memory = GetAllocator().Realloc(m_Memory, m_ItemCount * sizeof(ValueType));
 	m_MemorySize = m_ItemCount * sizeof(ValueType);
 }
 
-template< typename ValueType, typename Allocator >
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
 template< typename... WriteValues >
-void DynamicArray<ValueType, Allocator>::Resize(size_t desiredSize, WriteValues&&... defaultValues) {
+void DynamicArray<ValueType, Allocator, GrowthPolicy>::Resize(size_t desiredSize, WriteValues&&... defaultValues) {
 
 	// Call Clear if you want to empty out the array
 	MIST_ASSERT(desiredSize > 0);
@@ -168,41 +332,181 @@ void DynamicArray<ValueType, Allocator>::Resize(size_t desiredSize, WriteValues&
 	if (m_ItemCount == desiredSize) {
 		return;
 	}
-	// If the new size is larger than the current size, add elements until we've reached that size
+	// If the new size is larger than the current size, reserve the memory once and fill in the new elements
 	else if (desiredSize > m_ItemCount) {
 		size_t newItemCount = desiredSize - m_ItemCount;
-		for (size_t i = 0; i < newItemCount; ++i) {
-			InsertAsLast(std::forward<WriteValues>(defaultValues)...);
+		if (ReservedSize() < desiredSize) {
+			ReserveAdditional(desiredSize - ReservedSize());
 		}
+
+		// Value initializing a trivial type simply zeroes it
+		using IsZeroFill = std::integral_constant<bool, sizeof...(WriteValues) == 0 && std::is_trivial<ValueType>::value>;
+		ResizeFillAsLast(newItemCount, IsZeroFill(), defaultValues...);
 	}
 	// If the new size is smaller than the current size, remove elements until we've reache that size
 	// if (desiredSize < m_ItemCount)
 	else {
-		size_t removedItemCount = m_ItemCount - desiredSize;
-		for (size_t i = 0; i < removedItemCount; ++i) {
-			RemoveLast();
-		}
+		RemoveLast(m_ItemCount - desiredSize);
 	}
 
 	MIST_ASSERT(m_ItemCount == desiredSize);
 }
 
-template< typename ValueType, typename Allocator >
-void DynamicArray<ValueType, Allocator>::ReserveAdditional(size_t size) {
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+void DynamicArray<ValueType, Allocator, GrowthPolicy>::ReserveAdditional(size_t size) {
 
 	// Assure that we reserve the byte memory, not just the count of items
-	m_Memory = Allocator:: template Realloc(m_Memory, m_MemorySize + size * sizeof(ValueType));
+	m_Memory = GetAllocator().Realloc(m_Memory, m_MemorySize + size * sizeof(ValueType));
 	m_MemorySize += size * sizeof(ValueType);
 }
 
-template< typename ValueType, typename Allocator >
-ValueType& DynamicArray<ValueType, Allocator>::operator[](size_t index) {
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+void DynamicArray<ValueType, Allocator, GrowthPolicy>::GrowToFit(size_t requiredCapacity) {
+
+	size_t currentCapacity = ReservedSize();
+	size_t newCapacity = GrowthPolicy()(currentCapacity, requiredCapacity);
+	MIST_ASSERT(newCapacity >= requiredCapacity);
+
+	ReserveAdditional(newCapacity - currentCapacity);
+}
+
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+void DynamicArray<ValueType, Allocator, GrowthPolicy>::EnsureCapacity(size_t requiredCapacity) {
+
+	if (ReservedSize() < requiredCapacity) {
+		GrowToFit(requiredCapacity);
+	}
+}
+
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+template< typename... WriteValues >
+void DynamicArray<ValueType, Allocator, GrowthPolicy>::FillAsLast(size_t count, std::true_type, WriteValues&&... writeValues) {
+
+	MIST_ASSERT(m_ItemCount + count <= ReservedSize());
+
+	// Construct the first value and then keep doubling the copied region
+	ValueType* destination = AsRawArray() + m_ItemCount;
+	new (destination) ValueType(std::forward<WriteValues>(writeValues)...);
+
+	size_t filledCount = 1;
+	while (filledCount < count) {
+		size_t copyCount = filledCount < count - filledCount ? filledCount : count - filledCount;
+		memcpy(destination + filledCount, destination, copyCount * sizeof(ValueType));
+		filledCount += copyCount;
+	}
+
+	m_ItemCount += count;
+}
+
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+template< typename... WriteValues >
+void DynamicArray<ValueType, Allocator, GrowthPolicy>::FillAsLast(size_t count, std::false_type, WriteValues&&... writeValues) {
+
+	MIST_ASSERT(m_ItemCount + count <= ReservedSize());
+
+	ValueType* destination = AsRawArray() + m_ItemCount;
+	for (size_t i = 0; i < count; ++i) {
+		new (destination + i) ValueType(writeValues...);
+		// Assure that we update our amount of items as we go
+		m_ItemCount++;
+	}
+}
+
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+void DynamicArray<ValueType, Allocator, GrowthPolicy>::ResizeFillAsLast(size_t count, std::true_type) {
+
+	MIST_ASSERT(m_ItemCount + count <= ReservedSize());
+
+	memset(AsRawArray() + m_ItemCount, 0, count * sizeof(ValueType));
+	m_ItemCount += count;
+}
+
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+template< typename... WriteValues >
+void DynamicArray<ValueType, Allocator, GrowthPolicy>::ResizeFillAsLast(size_t count, std::false_type, WriteValues&&... writeValues) {
+
+	FillAsLast(count, typename std::is_trivially_copyable<ValueType>::type(), writeValues...);
+}
+
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+template< typename IteratorType >
+void DynamicArray<ValueType, Allocator, GrowthPolicy>::CopyAsLast(IteratorType rangeBegin, size_t count, std::true_type) {
+
+	MIST_ASSERT(m_ItemCount + count <= ReservedSize());
+
+	memcpy(AsRawArray() + m_ItemCount, rangeBegin, count * sizeof(ValueType));
+	m_ItemCount += count;
+}
+
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+template< typename IteratorType >
+void DynamicArray<ValueType, Allocator, GrowthPolicy>::CopyAsLast(IteratorType rangeBegin, size_t count, std::false_type) {
+
+	MIST_ASSERT(m_ItemCount + count <= ReservedSize());
+
+	ValueType* destination = AsRawArray() + m_ItemCount;
+	for (size_t i = 0; i < count; ++i, ++rangeBegin) {
+		new (destination + i) ValueType(*rangeBegin);
+		m_ItemCount++;
+	}
+}
+
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+template< typename IteratorType >
+size_t DynamicArray<ValueType, Allocator, GrowthPolicy>::IndexInArray(IteratorType iterator, std::true_type) const {
+
+	// Compare the addresses as integers, pointers outside of the array can't be compared with it
+	size_t address = reinterpret_cast<size_t>(iterator);
+	size_t arrayAddress = reinterpret_cast<size_t>(m_Memory);
+	if (m_Memory == nullptr || address < arrayAddress || address >= arrayAddress + m_ItemCount * sizeof(ValueType)) {
+		return m_ItemCount;
+	}
+	return (address - arrayAddress) / sizeof(ValueType);
+}
+
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+template< typename IteratorType >
+size_t DynamicArray<ValueType, Allocator, GrowthPolicy>::IndexInArray(IteratorType, std::false_type) const {
+
+	return m_ItemCount;
+}
+
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+void DynamicArray<ValueType, Allocator, GrowthPolicy>::DestroyLast(size_t count, std::true_type) {
+
+	m_ItemCount -= count;
+
+#if MIST_DEBUG
+	// Scramble the items to assure that they aren't reused and assure that we crash the program
+	memset(AsRawArray() + m_ItemCount, 0xDB, count * sizeof(ValueType));
+#endif
+}
+
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+void DynamicArray<ValueType, Allocator, GrowthPolicy>::DestroyLast(size_t count, std::false_type) {
+
+	for (size_t i = 0; i < count; ++i) {
+		// Decrement our item count and call the destructor on the last item
+		ValueType* lastItem = LastValue();
+		lastItem->ValueType::~ValueType();
+
+		m_ItemCount--;
+
+#if MIST_DEBUG
+		// Scramble the item to assure that it isn't reused and assure that we crash the program
+		memset(static_cast<void*>(lastItem), 0xDB, sizeof(ValueType));
+#endif
+	}
+}
+
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+ValueType& DynamicArray<ValueType, Allocator, GrowthPolicy>::operator[](size_t index) {
 
 	return *GetValue(index);
 }
 
-template< typename ValueType, typename Allocator >
-ValueType* DynamicArray<ValueType, Allocator>::GetValue(size_t index) {
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+ValueType* DynamicArray<ValueType, Allocator, GrowthPolicy>::GetValue(size_t index) {
 
 	MIST_ASSERT(index < m_ItemCount);
 
@@ -210,85 +514,99 @@ ValueType* DynamicArray<ValueType, Allocator>::GetValue(size_t index) {
 	return values + index;
 }
 
-template< typename ValueType, typename Allocator >
-ValueType* DynamicArray<ValueType, Allocator>::FirstValue() {
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+ValueType* DynamicArray<ValueType, Allocator, GrowthPolicy>::FirstValue() {
 
 	return GetValue(0);
 }
 
-template< typename ValueType, typename Allocator >
-ValueType* DynamicArray<ValueType, Allocator>::LastValue() {
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+ValueType* DynamicArray<ValueType, Allocator, GrowthPolicy>::LastValue() {
 
 	return GetValue(m_ItemCount - 1);
 }
 
-template< typename ValueType, typename Allocator >
-ValueType* DynamicArray<ValueType, Allocator>::AsRawArray() {
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+ValueType* DynamicArray<ValueType, Allocator, GrowthPolicy>::AsRawArray() {
 
 	return reinterpret_cast<ValueType*>(m_Memory);
 }
 
-template< typename ValueType, typename Allocator >
-size_t DynamicArray<ValueType, Allocator>::Size() const {
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+size_t DynamicArray<ValueType, Allocator, GrowthPolicy>::Size() const {
 
 	return m_ItemCount;
 }
 
-template< typename ValueType, typename Allocator >
-size_t DynamicArray<ValueType, Allocator>::ReservedSize() const {
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+size_t DynamicArray<ValueType, Allocator, GrowthPolicy>::ReservedSize() const {
 
 	return m_MemorySize / sizeof(ValueType);
 }
 
-template< typename ValueType, typename Allocator >
-void DynamicArray<ValueType, Allocator>::Clear() {
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+Allocator& DynamicArray<ValueType, Allocator, GrowthPolicy>::GetAllocator() {
 
-	if (m_ItemCount == 0) {
-		return;
-	}
+	return *this;
+}
+
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+void DynamicArray<ValueType, Allocator, GrowthPolicy>::Clear() {
 
-	// loop through and remove all the elements
-	size_t arraySize = Size();
-	for (size_t i = 0; i < arraySize; ++i) {
-		RemoveLast();
+	ClearKeepCapacity();
+
+	// The array might have reserved memory without ever holding any elements
+	if (m_Memory == nullptr) {
+		return;
 	}
 
-	Allocator:: template Free(m_Memory);
+	GetAllocator().Free(m_Memory);
 	m_Memory = nullptr;
 	m_MemorySize = 0;
+}
+
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+void DynamicArray<ValueType, Allocator, GrowthPolicy>::ClearKeepCapacity() {
+
+	RemoveLast(m_ItemCount);
 
 	MIST_ASSERT(m_ItemCount == 0);
 }
 
-template< typename ValueType, typename Allocator >
-ValueType* DynamicArray<ValueType, Allocator>::begin() {
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+ValueType* DynamicArray<ValueType, Allocator, GrowthPolicy>::begin() {
 
 	return reinterpret_cast<ValueType*>(m_Memory);
 }
 
-template< typename ValueType, typename Allocator >
-ValueType* DynamicArray<ValueType, Allocator>::end() {
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+ValueType* DynamicArray<ValueType, Allocator, GrowthPolicy>::end() {
 
 	return reinterpret_cast<ValueType*>(m_Memory) + m_ItemCount;
 }
 
-template< typename ValueType, typename Allocator >
-DynamicArray<ValueType, Allocator>::DynamicArray(size_t desiredReservedSpace) {
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+DynamicArray<ValueType, Allocator, GrowthPolicy>::DynamicArray(const Allocator& allocator) : Allocator(allocator) {}
+
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+DynamicArray<ValueType, Allocator, GrowthPolicy>::DynamicArray(size_t desiredReservedSpace, const Allocator& allocator) : Allocator(allocator) {
 
 	ReserveAdditional(desiredReservedSpace);
 }
 
-template< typename ValueType, typename Allocator >
-DynamicArray<ValueType, Allocator>::DynamicArray(DynamicArray&& rhs) {
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+DynamicArray<ValueType, Allocator, GrowthPolicy>::DynamicArray(DynamicArray&& rhs) : Allocator(rhs.GetAllocator()) {
 
 	std::swap(m_Memory, rhs.m_Memory);
 	std::swap(m_MemorySize, rhs.m_MemorySize);
 	std::swap(m_ItemCount, rhs.m_ItemCount);
 }
 
-template< typename ValueType, typename Allocator >
-DynamicArray<ValueType, Allocator>& DynamicArray<ValueType, Allocator>::operator=(DynamicArray&& rhs) {
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+DynamicArray<ValueType, Allocator, GrowthPolicy>& DynamicArray<ValueType, Allocator, GrowthPolicy>::operator=(DynamicArray&& rhs) {
 
+	// The memory belongs to the allocator, assure that the allocators follow their memory
+	std::swap(GetAllocator(), rhs.GetAllocator());
 	std::swap(m_Memory, rhs.m_Memory);
 	std::swap(m_MemorySize, rhs.m_MemorySize);
 	std::swap(m_ItemCount, rhs.m_ItemCount);
@@ -296,8 +614,8 @@ DynamicArray<ValueType, Allocator>& DynamicArray<ValueType, Allocator>::operator
 	return *this;
 }
 
-template< typename ValueType, typename Allocator >
-DynamicArray<ValueType, Allocator>::~DynamicArray() {
+template< typename ValueType, typename Allocator, typename GrowthPolicy >
+DynamicArray<ValueType, Allocator, GrowthPolicy>::~DynamicArray() {
 
 	Clear();
 }
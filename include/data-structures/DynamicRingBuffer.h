@@ -0,0 +1,230 @@
+#pragma once
+
+#include <Mist_Common/include/UtilityMacros.h>
+#include "../allocators/CppAllocator.h"
+#include <cstring>
+#include <utility>
+#include <type_traits>
+
+MIST_NAMESPACE
+
+// A ring buffer with a capacity chosen at runtime, the slots are allocated from the allocator.
+// @Details: The slots are left uninitialized, values are only constructed when they are written
+//  and destroyed when they are read. Unlike the RingBuffer, every slot of the capacity can be written to.
+//  The allocator is stored as a private base in the same way as the DynamicArray.
+// @Example: A ring sized from a config would look like:
+//
+//		DynamicRingBuffer<Event> events(config.EventCount);
+//		events.TryWrite(Event());
+//		Event event;
+//		while(events.TryRead(&event)) {
+//			Handle(event);
+//		}
+template< typename ValueType, typename Allocator = CppAllocator >
+class DynamicRingBuffer : private Allocator {
+
+public:
+
+	// -Public API-
+
+	// Attempts to read from the buffer, also consumes the read.
+	// returns false if no value is available to read
+	bool TryRead(ValueType* outValue);
+
+	// Attempts to read from the buffer, does not consume the read.
+	// returns false if no value is available to read
+	bool TryPeek(ValueType* outValue) const;
+
+	// Determine if there is any valid data for the user to read from the buffer
+	bool CanRead() const;
+
+	// Write a value into the buffer, moving the write head forward.
+	// If the method returns false, that means the buffer is full and nothing is written
+	template< typename WriteType = ValueType,
+		// @Template condition: the Writing type must be convertible to value type
+		typename TemplateCondition = typename std::enable_if<std::is_convertible<WriteType, ValueType>::value>::type >
+	bool TryWrite(WriteType&& writeValue);
+
+	// Determine if there is space to write to in the buffer
+	bool CanWrite() const;
+
+	// Determine how many values are available to read
+	size_t ReadableCount() const;
+
+	size_t Size() const;
+
+	// Retrieve the allocator used for the slots
+	Allocator& GetAllocator();
+
+
+	// -Types-
+	using Type = ValueType;
+
+
+	// -Structors-
+
+	// Create a ring buffer that can hold capacity values
+	explicit DynamicRingBuffer(size_t capacity, const Allocator& allocator = Allocator());
+
+	~DynamicRingBuffer();
+
+	// Copying is disallowed for the same reasons as the DynamicArray
+	DynamicRingBuffer(const DynamicRingBuffer&) = delete;
+	DynamicRingBuffer& operator=(const DynamicRingBuffer&) = delete;
+
+	DynamicRingBuffer(DynamicRingBuffer&& rhs);
+	DynamicRingBuffer& operator=(DynamicRingBuffer&& rhs);
+
+private:
+
+	// Wrap an index that is less than 2 * capacity back into the buffer
+	size_t WrapIndex(size_t index) const;
+
+	ValueType* m_Values = nullptr;
+	size_t m_Capacity = 0;
+	// Determines the location of the next read
+	size_t m_ReadHead = 0;
+	// The amount of values written and not yet read
+	size_t m_Count = 0;
+};
+
+
+// -Implementation-
+
+template< typename ValueType, typename Allocator >
+bool DynamicRingBuffer<ValueType, Allocator>::TryRead(ValueType* outValue) {
+
+	if (CanRead() == false) {
+		return false;
+	}
+
+	ValueType* value = m_Values + m_ReadHead;
+	*outValue = std::move(*value);
+	value->ValueType::~ValueType();
+
+#if MIST_DEBUG
+	// Scramble the slot to assure that it isn't reused
+	memset(static_cast<void*>(value), 0xDB, sizeof(ValueType));
+#endif
+
+	m_ReadHead = WrapIndex(m_ReadHead + 1);
+	m_Count--;
+	return true;
+}
+
+template< typename ValueType, typename Allocator >
+bool DynamicRingBuffer<ValueType, Allocator>::TryPeek(ValueType* outValue) const {
+
+	if (CanRead() == false) {
+		return false;
+	}
+
+	*outValue = m_Values[m_ReadHead];
+	return true;
+}
+
+template< typename ValueType, typename Allocator >
+bool DynamicRingBuffer<ValueType, Allocator>::CanRead() const {
+
+	return m_Count > 0;
+}
+
+template< typename ValueType, typename Allocator >
+template< typename WriteType,
+	// @Template Condition: links to condition in class definition
+	typename TemplateCondition >
+bool DynamicRingBuffer<ValueType, Allocator>::TryWrite(WriteType&& writeValue) {
+
+	if (CanWrite() == false) {
+		return false;
+	}
+
+	// Construct the value in place, the slot is uninitialized memory
+	size_t writeHead = WrapIndex(m_ReadHead + m_Count);
+	new (m_Values + writeHead) ValueType(std::forward<WriteType>(writeValue));
+
+	m_Count++;
+	return true;
+}
+
+template< typename ValueType, typename Allocator >
+bool DynamicRingBuffer<ValueType, Allocator>::CanWrite() const {
+
+	return m_Count < m_Capacity;
+}
+
+template< typename ValueType, typename Allocator >
+size_t DynamicRingBuffer<ValueType, Allocator>::ReadableCount() const {
+
+	return m_Count;
+}
+
+template< typename ValueType, typename Allocator >
+size_t DynamicRingBuffer<ValueType, Allocator>::Size() const {
+
+	return m_Capacity;
+}
+
+template< typename ValueType, typename Allocator >
+Allocator& DynamicRingBuffer<ValueType, Allocator>::GetAllocator() {
+
+	return *this;
+}
+
+template< typename ValueType, typename Allocator >
+DynamicRingBuffer<ValueType, Allocator>::DynamicRingBuffer(size_t capacity, const Allocator& allocator)
+	: Allocator(allocator), m_Capacity(capacity) {
+
+	// A ring buffer of size 0 can't hold anything, is it a typo?
+	MIST_ASSERT(capacity > 0);
+
+	m_Values = static_cast<ValueType*>(GetAllocator().Alloc(capacity * sizeof(ValueType)));
+	MIST_ASSERT(m_Values != nullptr);
+}
+
+template< typename ValueType, typename Allocator >
+DynamicRingBuffer<ValueType, Allocator>::~DynamicRingBuffer() {
+
+	// The buffer might have been moved from
+	if (m_Values == nullptr) {
+		return;
+	}
+
+	// Destroy the values that were never read
+	for (size_t i = 0; i < m_Count; ++i) {
+		m_Values[WrapIndex(m_ReadHead + i)].ValueType::~ValueType();
+	}
+
+	GetAllocator().Free(static_cast<void*>(m_Values));
+}
+
+template< typename ValueType, typename Allocator >
+DynamicRingBuffer<ValueType, Allocator>::DynamicRingBuffer(DynamicRingBuffer&& rhs) : Allocator(rhs.GetAllocator()) {
+
+	std::swap(m_Values, rhs.m_Values);
+	std::swap(m_Capacity, rhs.m_Capacity);
+	std::swap(m_ReadHead, rhs.m_ReadHead);
+	std::swap(m_Count, rhs.m_Count);
+}
+
+template< typename ValueType, typename Allocator >
+DynamicRingBuffer<ValueType, Allocator>& DynamicRingBuffer<ValueType, Allocator>::operator=(DynamicRingBuffer&& rhs) {
+
+	// The slots belong to the allocator, assure that the allocators follow their slots
+	std::swap(GetAllocator(), rhs.GetAllocator());
+	std::swap(m_Values, rhs.m_Values);
+	std::swap(m_Capacity, rhs.m_Capacity);
+	std::swap(m_ReadHead, rhs.m_ReadHead);
+	std::swap(m_Count, rhs.m_Count);
+
+	return *this;
+}
+
+template< typename ValueType, typename Allocator >
+size_t DynamicRingBuffer<ValueType, Allocator>::WrapIndex(size_t index) const {
+
+	MIST_ASSERT(index < 2 * m_Capacity);
+	return index >= m_Capacity ? index - m_Capacity : index;
+}
+
+MIST_NAMESPACE_END
@@ -0,0 +1,338 @@
+#pragma once
+
+#include <Mist_Common/include/UtilityMacros.h>
+#include "../allocators/CppAllocator.h"
+#include "DynamicArray.h"
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+MIST_NAMESPACE
+
+// The inline dynamic array stores it's first tInlineCount elements inside of the array itself and only
+// allocates memory from the allocator once it grows past that count. Most small arrays never touch the allocator.
+// @Detail: like the DynamicArray, the elements are moved around in memory with memcpy when the array grows,
+//  once the array has spilled to the allocator it doesn't return to the inline storage until it is cleared.
+template< typename ValueType, size_t tInlineCount, typename Allocator = CppAllocator, typename GrowthPolicy = DoubleGrowthPolicy >
+class InlineDynamicArray : private Allocator {
+	static_assert(tInlineCount > 0, "An Inline Dynamic Array must have room for at least one inline element.");
+
+public:
+
+	// -Public API-
+
+	// Write a value into the array at the back
+	template< typename... WriteType >
+	void InsertAsLast(WriteType&&... writeValue);
+
+	// Remove the last element of the array.
+	// @Detail: the array will not shrink
+	void RemoveLast();
+
+	// Remove the last count elements of the array.
+	// @Detail: the array will not shrink, trivially destructible types are removed in O(1)
+	void RemoveLast(size_t count);
+
+	// This resizes the amount of allocated memory to fit the size specified
+	// @Detail: if the reserved size still fits in the inline storage, nothing is allocated
+	void ReserveAdditional(size_t size);
+
+	ValueType& operator[](size_t index);
+
+	ValueType* GetValue(size_t index);
+
+	ValueType* FirstValue();
+
+	ValueType* LastValue();
+
+	ValueType* AsRawArray();
+
+	size_t Size() const;
+
+	size_t ReservedSize() const;
+
+	// Determine if the elements are still stored inside of the array
+	bool IsInline() const;
+
+	// Retrieve the allocator used once the array outgrows the inline storage
+	Allocator& GetAllocator();
+
+	// Remove the contents of the array and release the allocated memory, the array returns to it's inline storage
+	void Clear();
+
+	// -Iterators-
+
+	ValueType* begin();
+	ValueType* end();
+
+	// -Structors-
+
+	InlineDynamicArray();
+
+	// Create an inline dynamic array that allocates from the allocator passed in once it outgrows the inline storage
+	explicit InlineDynamicArray(const Allocator& allocator);
+
+	~InlineDynamicArray();
+
+	// Copying is currently disalllowed for the same reasons as the DynamicArray
+	InlineDynamicArray(const InlineDynamicArray&) = delete;
+	InlineDynamicArray& operator=(const InlineDynamicArray&) = delete;
+
+	InlineDynamicArray(InlineDynamicArray&&);
+	InlineDynamicArray& operator=(InlineDynamicArray&&);
+
+private:
+
+	// Move the elements to a block of newCapacity elements from the allocator
+	void Relocate(size_t newCapacity);
+
+	// Take the elements of rhs, rhs is left empty
+	void TakeElements(InlineDynamicArray& rhs);
+
+	ValueType* InlineValues();
+
+	// Destroy the last count elements of the array, trivially destructible types don't need to visit every element
+	void DestroyLast(size_t count, std::true_type isTriviallyDestructible);
+
+	void DestroyLast(size_t count, std::false_type isTriviallyDestructible);
+
+	typename std::aligned_storage<sizeof(ValueType) * tInlineCount, alignof(ValueType)>::type m_InlineMemory;
+
+	ValueType* m_Memory = nullptr;
+	size_t m_ItemCount = 0;
+	size_t m_Capacity = tInlineCount;
+};
+
+// -Implementation-
+
+template< typename ValueType, size_t tInlineCount, typename Allocator, typename GrowthPolicy >
+template< typename... WriteType >
+void InlineDynamicArray<ValueType, tInlineCount, Allocator, GrowthPolicy>::InsertAsLast(WriteType&&... writeValue) {
+
+	// Assure that we have enough space
+	if (m_ItemCount == m_Capacity) {
+		size_t newCapacity = GrowthPolicy()(m_Capacity, m_ItemCount + 1);
+		MIST_ASSERT(newCapacity > m_ItemCount);
+		Relocate(newCapacity);
+	}
+
+	// Use placement new to place a new valuetype at the correct position in the array
+	ValueType* newItem = new (m_Memory + m_ItemCount) ValueType(std::forward<WriteType>(writeValue)...);
+	MIST_ASSERT(newItem != nullptr);
+
+	m_ItemCount++;
+}
+
+template< typename ValueType, size_t tInlineCount, typename Allocator, typename GrowthPolicy >
+void InlineDynamicArray<ValueType, tInlineCount, Allocator, GrowthPolicy>::RemoveLast() {
+
+	RemoveLast(1);
+}
+
+template< typename ValueType, size_t tInlineCount, typename Allocator, typename GrowthPolicy >
+void InlineDynamicArray<ValueType, tInlineCount, Allocator, GrowthPolicy>::RemoveLast(size_t count) {
+
+	MIST_ASSERT(count <= m_ItemCount);
+	if (count == 0) {
+		return;
+	}
+
+	DestroyLast(count, typename std::is_trivially_destructible<ValueType>::type());
+}
+
+template< typename ValueType, size_t tInlineCount, typename Allocator, typename GrowthPolicy >
+void InlineDynamicArray<ValueType, tInlineCount, Allocator, GrowthPolicy>::ReserveAdditional(size_t size) {
+
+	if (m_ItemCount + size > m_Capacity) {
+		Relocate(m_ItemCount + size);
+	}
+}
+
+template< typename ValueType, size_t tInlineCount, typename Allocator, typename GrowthPolicy >
+ValueType& InlineDynamicArray<ValueType, tInlineCount, Allocator, GrowthPolicy>::operator[](size_t index) {
+
+	return *GetValue(index);
+}
+
+template< typename ValueType, size_t tInlineCount, typename Allocator, typename GrowthPolicy >
+ValueType* InlineDynamicArray<ValueType, tInlineCount, Allocator, GrowthPolicy>::GetValue(size_t index) {
+
+	MIST_ASSERT(index < m_ItemCount);
+	return m_Memory + index;
+}
+
+template< typename ValueType, size_t tInlineCount, typename Allocator, typename GrowthPolicy >
+ValueType* InlineDynamicArray<ValueType, tInlineCount, Allocator, GrowthPolicy>::FirstValue() {
+
+	return GetValue(0);
+}
+
+template< typename ValueType, size_t tInlineCount, typename Allocator, typename GrowthPolicy >
+ValueType* InlineDynamicArray<ValueType, tInlineCount, Allocator, GrowthPolicy>::LastValue() {
+
+	return GetValue(m_ItemCount - 1);
+}
+
+template< typename ValueType, size_t tInlineCount, typename Allocator, typename GrowthPolicy >
+ValueType* InlineDynamicArray<ValueType, tInlineCount, Allocator, GrowthPolicy>::AsRawArray() {
+
+	return m_Memory;
+}
+
+template< typename ValueType, size_t tInlineCount, typename Allocator, typename GrowthPolicy >
+size_t InlineDynamicArray<ValueType, tInlineCount, Allocator, GrowthPolicy>::Size() const {
+
+	return m_ItemCount;
+}
+
+template< typename ValueType, size_t tInlineCount, typename Allocator, typename GrowthPolicy >
+size_t InlineDynamicArray<ValueType, tInlineCount, Allocator, GrowthPolicy>::ReservedSize() const {
+
+	return m_Capacity;
+}
+
+template< typename ValueType, size_t tInlineCount, typename Allocator, typename GrowthPolicy >
+bool InlineDynamicArray<ValueType, tInlineCount, Allocator, GrowthPolicy>::IsInline() const {
+
+	return m_Memory == reinterpret_cast<const ValueType*>(&m_InlineMemory);
+}
+
+template< typename ValueType, size_t tInlineCount, typename Allocator, typename GrowthPolicy >
+Allocator& InlineDynamicArray<ValueType, tInlineCount, Allocator, GrowthPolicy>::GetAllocator() {
+
+	return *this;
+}
+
+template< typename ValueType, size_t tInlineCount, typename Allocator, typename GrowthPolicy >
+void InlineDynamicArray<ValueType, tInlineCount, Allocator, GrowthPolicy>::Clear() {
+
+	RemoveLast(m_ItemCount);
+
+	if (IsInline() == false) {
+		GetAllocator().Free(static_cast<void*>(m_Memory));
+		m_Memory = InlineValues();
+		m_Capacity = tInlineCount;
+	}
+
+	MIST_ASSERT(m_ItemCount == 0);
+}
+
+template< typename ValueType, size_t tInlineCount, typename Allocator, typename GrowthPolicy >
+ValueType* InlineDynamicArray<ValueType, tInlineCount, Allocator, GrowthPolicy>::begin() {
+
+	return m_Memory;
+}
+
+template< typename ValueType, size_t tInlineCount, typename Allocator, typename GrowthPolicy >
+ValueType* InlineDynamicArray<ValueType, tInlineCount, Allocator, GrowthPolicy>::end() {
+
+	return m_Memory + m_ItemCount;
+}
+
+template< typename ValueType, size_t tInlineCount, typename Allocator, typename GrowthPolicy >
+InlineDynamicArray<ValueType, tInlineCount, Allocator, GrowthPolicy>::InlineDynamicArray() : m_Memory(InlineValues()) {}
+
+template< typename ValueType, size_t tInlineCount, typename Allocator, typename GrowthPolicy >
+InlineDynamicArray<ValueType, tInlineCount, Allocator, GrowthPolicy>::InlineDynamicArray(const Allocator& allocator)
+	: Allocator(allocator), m_Memory(InlineValues()) {}
+
+template< typename ValueType, size_t tInlineCount, typename Allocator, typename GrowthPolicy >
+InlineDynamicArray<ValueType, tInlineCount, Allocator, GrowthPolicy>::~InlineDynamicArray() {
+
+	Clear();
+}
+
+template< typename ValueType, size_t tInlineCount, typename Allocator, typename GrowthPolicy >
+InlineDynamicArray<ValueType, tInlineCount, Allocator, GrowthPolicy>::InlineDynamicArray(InlineDynamicArray&& rhs)
+	: Allocator(rhs.GetAllocator()), m_Memory(InlineValues()) {
+
+	TakeElements(rhs);
+}
+
+template< typename ValueType, size_t tInlineCount, typename Allocator, typename GrowthPolicy >
+InlineDynamicArray<ValueType, tInlineCount, Allocator, GrowthPolicy>&
+InlineDynamicArray<ValueType, tInlineCount, Allocator, GrowthPolicy>::operator=(InlineDynamicArray&& rhs) {
+
+	// Unlike the DynamicArray we can't simply swap, the inline elements live inside of the arrays themselves
+	Clear();
+	GetAllocator() = rhs.GetAllocator();
+	TakeElements(rhs);
+
+	return *this;
+}
+
+template< typename ValueType, size_t tInlineCount, typename Allocator, typename GrowthPolicy >
+void InlineDynamicArray<ValueType, tInlineCount, Allocator, GrowthPolicy>::Relocate(size_t newCapacity) {
+
+	MIST_ASSERT(newCapacity >= m_ItemCount);
+
+	ValueType* newMemory = nullptr;
+	if (IsInline()) {
+		// Spill the inline elements into memory from the allocator
+		newMemory = static_cast<ValueType*>(GetAllocator().Alloc(newCapacity * sizeof(ValueType)));
+		MIST_ASSERT(newMemory != nullptr);
+		memcpy(static_cast<void*>(newMemory), m_Memory, m_ItemCount * sizeof(ValueType));
+	}
+	else {
+		newMemory = static_cast<ValueType*>(GetAllocator().Realloc(m_Memory, newCapacity * sizeof(ValueType)));
+		MIST_ASSERT(newMemory != nullptr);
+	}
+
+	m_Memory = newMemory;
+	m_Capacity = newCapacity;
+}
+
+template< typename ValueType, size_t tInlineCount, typename Allocator, typename GrowthPolicy >
+void InlineDynamicArray<ValueType, tInlineCount, Allocator, GrowthPolicy>::TakeElements(InlineDynamicArray& rhs) {
+
+	MIST_ASSERT(IsInline() && m_ItemCount == 0);
+
+	if (rhs.IsInline()) {
+		memcpy(static_cast<void*>(m_Memory), rhs.m_Memory, rhs.m_ItemCount * sizeof(ValueType));
+	}
+	else {
+		// Steal the allocated memory, rhs returns to it's inline storage
+		m_Memory = rhs.m_Memory;
+		m_Capacity = rhs.m_Capacity;
+		rhs.m_Memory = rhs.InlineValues();
+		rhs.m_Capacity = tInlineCount;
+	}
+
+	m_ItemCount = rhs.m_ItemCount;
+	rhs.m_ItemCount = 0;
+}
+
+template< typename ValueType, size_t tInlineCount, typename Allocator, typename GrowthPolicy >
+ValueType* InlineDynamicArray<ValueType, tInlineCount, Allocator, GrowthPolicy>::InlineValues() {
+
+	return reinterpret_cast<ValueType*>(&m_InlineMemory);
+}
+
+template< typename ValueType, size_t tInlineCount, typename Allocator, typename GrowthPolicy >
+void InlineDynamicArray<ValueType, tInlineCount, Allocator, GrowthPolicy>::DestroyLast(size_t count, std::true_type) {
+
+	m_ItemCount -= count;
+
+#if MIST_DEBUG
+	// Scramble the items to assure that they aren't reused and assure that we crash the program
+	memset(static_cast<void*>(m_Memory + m_ItemCount), 0xDB, count * sizeof(ValueType));
+#endif
+}
+
+template< typename ValueType, size_t tInlineCount, typename Allocator, typename GrowthPolicy >
+void InlineDynamicArray<ValueType, tInlineCount, Allocator, GrowthPolicy>::DestroyLast(size_t count, std::false_type) {
+
+	for (size_t i = 0; i < count; ++i) {
+		ValueType* lastItem = LastValue();
+		lastItem->ValueType::~ValueType();
+
+		m_ItemCount--;
+
+#if MIST_DEBUG
+		// Scramble the item to assure that it isn't reused and assure that we crash the program
+		memset(static_cast<void*>(lastItem), 0xDB, sizeof(ValueType));
+#endif
+	}
+}
+
+MIST_NAMESPACE_END
@@ -0,0 +1,208 @@
+#pragma once
+
+#include <Mist_Common/include/UtilityMacros.h>
+#include "../utility/CacheLine.h"
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <type_traits>
+
+MIST_NAMESPACE
+
+// A bounded multiple producer, multiple consumer ring buffer. Any thread can read or write concurrently.
+// @Details: Every slot holds a sequence number that tells the writers and readers whose turn it is to use the slot,
+//  a thread claims a slot by advancing the shared write or read position with a compare and swap.
+//  Claiming a slot is lock-free but the buffer isn't wait-free: a producer or consumer that stalls after claiming
+//  a slot holds up the buffer at that slot, the readers can't read past it and the writers block once they wrap around to it.
+//  Unlike the RingBuffer, all of the tSize slots can be written to, tSize must be a power of 2.
+// @Example: A shared task queue would look like:
+//
+//		MpmcRingBuffer<Task, 1024> tasks;
+//		// Any producer thread
+//		tasks.Write(task);
+//		// Any worker thread
+//		Task task;
+//		if(tasks.TryRead(&task)) {
+//			task.Run();
+//		}
+template< typename ValueType, size_t tSize >
+class MpmcRingBuffer {
+	static_assert(tSize > 1, "A Ring Buffer Cannot be of size 0. Is it a typo?");
+	static_assert((tSize & (tSize - 1)) == 0, "A Multiple Producer Multiple Consumer Ring Buffer must be a power of 2.");
+
+public:
+
+	// -Public API-
+
+	// Attempts to read from the buffer, also consumes the read.
+	// returns false if no value is available to read
+	bool TryRead(ValueType* outValue);
+
+	// Read from the buffer, waits until a value is available
+	void Read(ValueType* outValue);
+
+	// Attempts to write a value into the buffer.
+	// If the method returns false, that means the buffer is full and nothing is written
+	template< typename WriteType = ValueType,
+		// @Template condition: the Writing type must be convertible to value type
+		typename TemplateCondition = typename std::enable_if<std::is_convertible<WriteType, ValueType>::value>::type >
+	bool TryWrite(WriteType&& writeValue);
+
+	// Write a value into the buffer, waits until there is space to write to
+	template< typename WriteType = ValueType,
+		// @Template condition: the Writing type must be convertible to value type
+		typename TemplateCondition = typename std::enable_if<std::is_convertible<WriteType, ValueType>::value>::type >
+	void Write(WriteType&& writeValue);
+
+	size_t Size() const;
+
+
+	// -Types-
+	using Type = ValueType;
+
+
+	// -Structors-
+	MpmcRingBuffer();
+
+	MpmcRingBuffer(const MpmcRingBuffer&) = delete;
+	MpmcRingBuffer& operator=(const MpmcRingBuffer&) = delete;
+
+private:
+
+	static constexpr size_t INDEX_MASK = tSize - 1;
+
+	// Give the other threads a chance to progress while waiting on the buffer
+	static void Wait();
+
+	struct Slot {
+		// When sequence == position, the slot is ready to be written for that position
+		// When sequence == position + 1, the slot is ready to be read for that position
+		std::atomic<size_t> m_Sequence;
+		ValueType m_Value;
+	};
+
+	// The position of the next read, shared by all the readers
+	alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_ReadPosition;
+	// The position of the next write, shared by all the writers
+	alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_WritePosition;
+
+	alignas(CACHE_LINE_SIZE) Slot m_Slots[tSize];
+};
+
+
+// -Implementation-
+
+template< typename ValueType, size_t tSize >
+bool MpmcRingBuffer<ValueType, tSize>::TryRead(ValueType* outValue) {
+
+	size_t position = m_ReadPosition.load(std::memory_order_relaxed);
+	Slot* slot = nullptr;
+
+	while (true) {
+		slot = &m_Slots[position & INDEX_MASK];
+		size_t sequence = slot->m_Sequence.load(std::memory_order_acquire);
+		intptr_t difference = (intptr_t)sequence - (intptr_t)(position + 1);
+
+		// The slot has been written, attempt to claim it
+		if (difference == 0) {
+			if (m_ReadPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+				break;
+			}
+		}
+		// The slot hasn't been written for this position yet, the buffer is empty
+		else if (difference < 0) {
+			return false;
+		}
+		// Another reader claimed the slot, catch up with the read position
+		else {
+			position = m_ReadPosition.load(std::memory_order_relaxed);
+		}
+	}
+
+	*outValue = std::move(slot->m_Value);
+
+	// Hand the slot to the writers of the next lap
+	slot->m_Sequence.store(position + tSize, std::memory_order_release);
+	return true;
+}
+
+template< typename ValueType, size_t tSize >
+void MpmcRingBuffer<ValueType, tSize>::Read(ValueType* outValue) {
+
+	while (TryRead(outValue) == false) {
+		Wait();
+	}
+}
+
+template< typename ValueType, size_t tSize >
+template< typename WriteType,
+	// @Template Condition: links to condition in class definition
+	typename TemplateCondition >
+bool MpmcRingBuffer<ValueType, tSize>::TryWrite(WriteType&& writeValue) {
+
+	size_t position = m_WritePosition.load(std::memory_order_relaxed);
+	Slot* slot = nullptr;
+
+	while (true) {
+		slot = &m_Slots[position & INDEX_MASK];
+		size_t sequence = slot->m_Sequence.load(std::memory_order_acquire);
+		intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+
+		// The slot is free, attempt to claim it
+		if (difference == 0) {
+			if (m_WritePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+				break;
+			}
+		}
+		// The slot hasn't been read from the previous lap yet, the buffer is full
+		else if (difference < 0) {
+			return false;
+		}
+		// Another writer claimed the slot, catch up with the write position
+		else {
+			position = m_WritePosition.load(std::memory_order_relaxed);
+		}
+	}
+
+	slot->m_Value = std::forward<WriteType>(writeValue);
+
+	// Publish the value to the readers
+	slot->m_Sequence.store(position + 1, std::memory_order_release);
+	return true;
+}
+
+template< typename ValueType, size_t tSize >
+template< typename WriteType,
+	// @Template Condition: links to condition in class definition
+	typename TemplateCondition >
+void MpmcRingBuffer<ValueType, tSize>::Write(WriteType&& writeValue) {
+
+	// @Detail: the value is only forwarded once TryWrite has claimed a slot, it's safe to retry with it
+	while (TryWrite(std::forward<WriteType>(writeValue)) == false) {
+		Wait();
+	}
+}
+
+template< typename ValueType, size_t tSize >
+size_t MpmcRingBuffer<ValueType, tSize>::Size() const {
+
+	return tSize;
+}
+
+template< typename ValueType, size_t tSize >
+void MpmcRingBuffer<ValueType, tSize>::Wait() {
+
+	std::this_thread::yield();
+}
+
+template< typename ValueType, size_t tSize >
+MpmcRingBuffer<ValueType, tSize>::MpmcRingBuffer() : m_ReadPosition(0), m_WritePosition(0), m_Slots() {
+
+	// Every slot starts out ready to be written for the first lap
+	for (size_t i = 0; i < tSize; ++i) {
+		m_Slots[i].m_Sequence.store(i, std::memory_order_relaxed);
+	}
+}
+
+MIST_NAMESPACE_END
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <utility>
+#include <algorithm>
+#include <type_traits>
 #include <Mist_Common/include/UtilityMacros.h>
 
 MIST_NAMESPACE
@@ -8,6 +10,7 @@ MIST_NAMESPACE
 // A simple ring buffer implementation with a read and write head. 
 // @Details: The size requested in the tSize parameter is not the guaranteed amount that you can write
 //  in one go. It typically will be tSize - 1, but that might change in time.
+//  A tSize that is a power of 2 lets the heads wrap around with a mask, other sizes wrap with a comparison.
 // @Example: A contrived example use would look like: 
 //
 //		RingBuffer<int, 10> buffer;
@@ -48,6 +51,31 @@ public:
 	// Determine if there is space to write to in the buffer
 	bool CanWrite() const;
 
+	// Write a value into the buffer, this never fails. If the buffer is full the oldest value is overwritten
+	// and the read head moves forward, this keeps the newest values for streams such as telemetry
+	template< typename WriteType = ValueType,
+		// @Template condition: the Writing type must be convertible to value type
+		typename TemplateCondition = typename std::enable_if<std::is_convertible<WriteType, ValueType>::value>::type >
+	void WriteOverwrite(WriteType&& writeValue);
+
+	// Copy up to count of the newest values from the buffer, oldest first. Returns the amount of values copied
+	// @Detail: the values are not consumed
+	size_t CopyNewest(ValueType* outValues, size_t count) const;
+
+	// Write up to count values into the buffer, returns the amount of values written
+	// @Detail: the values are copied in at most two contiguous spans
+	size_t TryWriteBatch(const ValueType* values, size_t count);
+
+	// Read up to maxCount values from the buffer, also consumes the reads. Returns the amount of values read
+	// @Detail: the values are copied in at most two contiguous spans
+	size_t TryReadBatch(ValueType* outValues, size_t maxCount);
+
+	// Determine how many values are available to read
+	size_t ReadableCount() const;
+
+	// Determine how many values can be written before the buffer is full
+	size_t WritableCount() const;
+
 	size_t Size() const;
 
 
@@ -59,6 +87,16 @@ public:
 	RingBuffer() : m_Values() {}
 
 private:
+
+	static constexpr bool IS_POWER_OF_TWO = (tSize & (tSize - 1)) == 0;
+
+	// Wrap an index that is less than 2 * tSize back into the buffer
+	static size_t WrapIndex(size_t index);
+
+	static size_t WrapIndex(size_t index, std::true_type isPowerOfTwo);
+
+	static size_t WrapIndex(size_t index, std::false_type isPowerOfTwo);
+
 	// Determines the previous region read in the buffer, it's always one step behind the next read
 	size_t m_ReadHead = 0;
 	// Determines the location that the next write will occure
@@ -76,7 +114,7 @@ bool RingBuffer<ValueType, tSize>::TryRead(ValueType* outValue) {
 		return false;
 	}
 
-	m_ReadHead = (m_ReadHead + 1) % tSize;
+	m_ReadHead = WrapIndex(m_ReadHead + 1);
 	*outValue = m_Values[m_ReadHead];
 	return true;
 }
@@ -87,7 +125,7 @@ bool RingBuffer<ValueType, tSize>::TryPeek(ValueType* outValue) const {
 		return false;
 	}
 
-	size_t readPosition = (m_ReadHead + 1) % tSize;
+	size_t readPosition = WrapIndex(m_ReadHead + 1);
 	*outValue = m_Values[readPosition];
 	return true;
 }
@@ -95,7 +133,7 @@ bool RingBuffer<ValueType, tSize>::TryPeek(ValueType* outValue) const {
 template< typename ValueType, size_t tSize >
 bool RingBuffer<ValueType, tSize>::CanRead() const {
 	// You can't read where hasn't been written yet
-	size_t readLocation = (m_ReadHead + 1) % tSize;
+	size_t readLocation = WrapIndex(m_ReadHead + 1);
 	return readLocation != m_WriteHead;
 }
 
@@ -111,7 +149,7 @@ bool RingBuffer<ValueType, tSize>::TryWrite(WriteType&& writeValue) {
 	m_Values[m_WriteHead] = std::forward<WriteType&&>(writeValue);
 
 	// Advance the write head
-	m_WriteHead = (m_WriteHead + 1) % tSize;
+	m_WriteHead = WrapIndex(m_WriteHead + 1);
 	return true;
 }
 
@@ -121,9 +159,92 @@ bool RingBuffer<ValueType, tSize>::CanWrite() const {
 	return (m_ReadHead == m_WriteHead) == false;
 }
 
+template< typename ValueType, size_t tSize >
+template< typename WriteType,
+	// @Template Condition: links to condition in class definition
+	typename TemplateCondition >
+void RingBuffer<ValueType, tSize>::WriteOverwrite(WriteType&& writeValue) {
+	// If the buffer is full, drop the oldest value by moving the read head forward
+	if (CanWrite() == false) {
+		m_ReadHead = WrapIndex(m_ReadHead + 1);
+	}
+
+	m_Values[m_WriteHead] = std::forward<WriteType&&>(writeValue);
+	m_WriteHead = WrapIndex(m_WriteHead + 1);
+}
+
+template< typename ValueType, size_t tSize >
+size_t RingBuffer<ValueType, tSize>::CopyNewest(ValueType* outValues, size_t count) const {
+	count = std::min(count, ReadableCount());
+
+	// The newest values end right before the write head
+	size_t readPosition = WrapIndex(m_WriteHead + tSize - count);
+	size_t firstSpan = std::min(count, tSize - readPosition);
+	std::copy(m_Values + readPosition, m_Values + readPosition + firstSpan, outValues);
+	std::copy(m_Values, m_Values + (count - firstSpan), outValues + firstSpan);
+
+	return count;
+}
+
+template< typename ValueType, size_t tSize >
+size_t RingBuffer<ValueType, tSize>::TryWriteBatch(const ValueType* values, size_t count) {
+	count = std::min(count, WritableCount());
+
+	// Write up to the end of the buffer and then wrap around to the front
+	size_t firstSpan = std::min(count, tSize - m_WriteHead);
+	std::copy(values, values + firstSpan, m_Values + m_WriteHead);
+	std::copy(values + firstSpan, values + count, m_Values);
+
+	m_WriteHead = WrapIndex(m_WriteHead + count);
+	return count;
+}
+
+template< typename ValueType, size_t tSize >
+size_t RingBuffer<ValueType, tSize>::TryReadBatch(ValueType* outValues, size_t maxCount) {
+	size_t count = std::min(maxCount, ReadableCount());
+
+	// Read up to the end of the buffer and then wrap around to the front
+	size_t readPosition = WrapIndex(m_ReadHead + 1);
+	size_t firstSpan = std::min(count, tSize - readPosition);
+	std::copy(m_Values + readPosition, m_Values + readPosition + firstSpan, outValues);
+	std::copy(m_Values, m_Values + (count - firstSpan), outValues + firstSpan);
+
+	m_ReadHead = WrapIndex(m_ReadHead + count);
+	return count;
+}
+
+template< typename ValueType, size_t tSize >
+size_t RingBuffer<ValueType, tSize>::ReadableCount() const {
+	// Everything between the previous read and the next write
+	return WrapIndex(m_WriteHead + tSize - m_ReadHead - 1);
+}
+
+template< typename ValueType, size_t tSize >
+size_t RingBuffer<ValueType, tSize>::WritableCount() const {
+	// Everything between the next write and the previous read
+	return WrapIndex(m_ReadHead + tSize - m_WriteHead);
+}
+
 template< typename ValueType, size_t tSize >
 size_t RingBuffer<ValueType, tSize>::Size() const {
 	return tSize;
 }
 
+template< typename ValueType, size_t tSize >
+size_t RingBuffer<ValueType, tSize>::WrapIndex(size_t index) {
+	return WrapIndex(index, std::integral_constant<bool, IS_POWER_OF_TWO>());
+}
+
+template< typename ValueType, size_t tSize >
+size_t RingBuffer<ValueType, tSize>::WrapIndex(size_t index, std::true_type) {
+	return index & (tSize - 1);
+}
+
+template< typename ValueType, size_t tSize >
+size_t RingBuffer<ValueType, tSize>::WrapIndex(size_t index, std::false_type) {
+	// The index is always less than 2 * tSize, a comparison is cheaper than a modulo
+	MIST_ASSERT(index < 2 * tSize);
+	return index >= tSize ? index - tSize : index;
+}
+
 MIST_NAMESPACE_END
@@ -7,8 +7,9 @@
 MIST_NAMESPACE
 
 // SingleList is a simple singly linked list
+// @Detail: the allocator is stored as a private base, stateless allocators don't add anything to the size of the list
 template< typename ValueType, typename Allocator = CppAllocator >
-class SingleList {
+class SingleList : private Allocator {
 
 public:
 
@@ -57,6 +58,9 @@ public:
 
 	void Clear();
 
+	// Retrieve the allocator used for the nodes of the list
+	Allocator& GetAllocator();
+
 	// -Iterators-
 
 	Iterator begin();
@@ -65,6 +69,10 @@ public:
 	// -Structors-
 
 	SingleList() = default;
+
+	// Create a list that allocates it's nodes from the allocator passed in
+	explicit SingleList(const Allocator& allocator);
+
 	~SingleList();
 
 	// Copying is currently disalllowed in the singlelist this is to avoid accidental copying, if it is desired,
@@ -90,7 +98,7 @@ public:
 
 		Node* operator++();
 
-		friend SingleList<ValueType>;
+		friend SingleList;
 
 		// Create a node with the designated value type
 		template< typename WriteType,
@@ -149,7 +157,7 @@ void SingleList<ValueType, Allocator>::InsertAfter(Node* node, WriteType&& write
 	}
 
 	MIST_ASSERT(node != nullptr);
-	Node* newNode = Allocator::template Alloc<Node>(std::forward<WriteType>(writeValue));
+	Node* newNode = GetAllocator().template Alloc<Node>(std::forward<WriteType>(writeValue));
 	newNode->m_Next = node->NextNode();
 	node->m_Next = newNode;
 }
@@ -164,12 +172,12 @@ void SingleList<ValueType, Allocator>::InsertAsFirst(WriteType&& writeValue) {
 	if (m_Head == nullptr) {
 
 		MIST_ASSERT(m_Tail == nullptr);
-		m_Head = Allocator::template Alloc<Node>(std::forward<WriteType>(writeValue));
+		m_Head = GetAllocator().template Alloc<Node>(std::forward<WriteType>(writeValue));
 		m_Tail = m_Head;
 	}
 	else {
 
-		Node* newNode = Allocator:: template Alloc<Node>(std::forward<WriteType>(writeValue));
+		Node* newNode = GetAllocator().template Alloc<Node>(std::forward<WriteType>(writeValue));
 		newNode->m_Next = m_Head;
 		m_Head = newNode;
 	}
@@ -185,13 +193,13 @@ void SingleList<ValueType, Allocator>::InsertAsLast(WriteType&& writeValue) {
 	if (m_Tail == nullptr) {
 		
 		MIST_ASSERT(m_Head == nullptr);
-		m_Tail = Allocator:: template Alloc<Node>(std::forward<WriteType>(writeValue));
+		m_Tail = GetAllocator().template Alloc<Node>(std::forward<WriteType>(writeValue));
 		m_Head = m_Tail;
 	}
 	else {
 
 		MIST_ASSERT(m_Tail->m_Next == nullptr);
-		m_Tail->m_Next = Allocator:: template Alloc<Node>(std::forward<WriteType>(writeValue));
+		m_Tail->m_Next = GetAllocator().template Alloc<Node>(std::forward<WriteType>(writeValue));
 		m_Tail = m_Tail->NextNode();
 	}
 }
@@ -212,7 +220,7 @@ void SingleList<ValueType, Allocator>::Remove(Node* node) {
 		}
 
 		m_Head = node->NextNode();
-		Allocator::Free(node);
+		GetAllocator().Free(node);
 		return;
 	}
 	else if (node == m_Tail) {
@@ -225,7 +233,7 @@ void SingleList<ValueType, Allocator>::Remove(Node* node) {
 		}
 
 		m_Tail->m_Next = nullptr;
-		Allocator::Free(node);
+		GetAllocator().Free(node);
 		return;
 	}
 
@@ -233,7 +241,7 @@ void SingleList<ValueType, Allocator>::Remove(Node* node) {
 
 		if (currentNode == node) {
 			
-			Allocator::Free(currentNode);
+			GetAllocator().Free(currentNode);
 			previousNode->m_Next = nullptr;
 			break;
 		}
@@ -327,7 +335,7 @@ void SingleList<ValueType, Allocator>::Clear() {
 	while (currentNode != nullptr) {
 		
 		Node* nextNode = currentNode->NextNode();
-		Allocator::Free(currentNode);
+		GetAllocator().Free(currentNode);
 		currentNode = nextNode;
 	}
 
@@ -335,6 +343,12 @@ void SingleList<ValueType, Allocator>::Clear() {
 	m_Tail = nullptr;
 }
 
+template< typename ValueType, typename Allocator >
+Allocator& SingleList<ValueType, Allocator>::GetAllocator() {
+
+	return *this;
+}
+
 template< typename ValueType, typename Allocator >
 typename SingleList<ValueType, Allocator>::Iterator SingleList<ValueType, Allocator>::begin() {
 
@@ -348,7 +362,7 @@ typename SingleList<ValueType, Allocator>::Iterator SingleList<ValueType, Alloca
 }
 
 template< typename ValueType, typename Allocator >
-SingleList<ValueType, Allocator>::SingleList(SingleList&& rhs) {
+SingleList<ValueType, Allocator>::SingleList(SingleList&& rhs) : Allocator(rhs.GetAllocator()) {
 
 	std::swap(m_Head, rhs.m_Head);
 	std::swap(m_Tail, rhs.m_Tail);
@@ -357,12 +371,17 @@ SingleList<ValueType, Allocator>::SingleList(SingleList&& rhs) {
 template< typename ValueType, typename Allocator >
 SingleList<ValueType, Allocator>& SingleList<ValueType, Allocator>::operator=(SingleList&& rhs) {
 
+	// The nodes belong to the allocator, assure that the allocators follow their nodes
+	std::swap(GetAllocator(), rhs.GetAllocator());
 	std::swap(m_Head, rhs.m_Head);
 	std::swap(m_Tail, rhs.m_Tail);
 
 	return *this;
 }
 
+template< typename ValueType, typename Allocator >
+SingleList<ValueType, Allocator>::SingleList(const Allocator& allocator) : Allocator(allocator) {}
+
 template< typename ValueType, typename Allocator >
 SingleList<ValueType, Allocator>::~SingleList() {
 
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <Mist_Common/include/UtilityMacros.h>
+#include "../utility/CacheLine.h"
+#include <atomic>
+#include <utility>
+#include <type_traits>
+
+MIST_NAMESPACE
+
+// A single producer, single consumer ring buffer. One thread can write while another thread reads
+// without any locks, every operation is wait-free.
+// @Details: The API matches the RingBuffer, the reading methods must only be called from the consumer thread
+//  and the writing methods must only be called from the producer thread. Like the RingBuffer, the amount
+//  you can write in one go is tSize - 1.
+//  The read and write heads live on their own cache lines, each side also keeps a cached copy of the other side's
+//  head in order to only touch the other side's cache line when the buffer looks full or empty.
+// @Example: A contrived example use would look like:
+//
+//		SpscRingBuffer<int, 64> buffer;
+//		// Producer thread
+//		while(buffer.TryWrite(20) == false) {}
+//		// Consumer thread
+//		int result = 0;
+//		while(buffer.TryRead(&result) == false) {}
+template< typename ValueType, size_t tSize >
+class SpscRingBuffer {
+	static_assert(tSize > 1, "A Ring Buffer Cannot be of size 0. Is it a typo?");
+
+public:
+
+	// -Public API-
+
+	// Attempts to read from the buffer, also consumes the read.
+	// returns false if no value is available to read
+	// @Detail: consumer thread only
+	bool TryRead(ValueType* outValue);
+
+	// Attempts to read from the buffer, does not consume the read.
+	// returns false if no value is available to read
+	// @Detail: consumer thread only
+	bool TryPeek(ValueType* outValue) const;
+
+	// Determine if there is any valid data for the user to read from the buffer
+	// @Detail: consumer thread only
+	bool CanRead() const;
+
+	// Write a value into the buffer, moving the write head forward.
+	// If the method returns false, that means the buffer is full and nothing is written
+	// @Detail: producer thread only
+	template< typename WriteType = ValueType,
+		// @Template condition: the Writing type must be convertible to value type
+		typename TemplateCondition = typename std::enable_if<std::is_convertible<WriteType, ValueType>::value>::type >
+	bool TryWrite(WriteType&& writeValue);
+
+	// Determine if there is space to write to in the buffer
+	// @Detail: producer thread only
+	bool CanWrite() const;
+
+	size_t Size() const;
+
+
+	// -Types-
+	using Type = ValueType;
+
+
+	// -Structors-
+	SpscRingBuffer() : m_ReadHead(0), m_WriteHead(0), m_Values() {}
+
+	SpscRingBuffer(const SpscRingBuffer&) = delete;
+	SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+private:
+
+	static size_t NextIndex(size_t index);
+
+	// -Consumer cache line-
+	// Determines the location of the next read
+	alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_ReadHead;
+	// The last write head seen by the consumer
+	size_t m_CachedWriteHead = 0;
+
+	// -Producer cache line-
+	// Determines the location that the next write will occur
+	alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_WriteHead;
+	// The last read head seen by the producer
+	size_t m_CachedReadHead = 0;
+
+	alignas(CACHE_LINE_SIZE) ValueType m_Values[tSize];
+};
+
+
+// -Implementation-
+
+template< typename ValueType, size_t tSize >
+bool SpscRingBuffer<ValueType, tSize>::TryRead(ValueType* outValue) {
+
+	size_t readHead = m_ReadHead.load(std::memory_order_relaxed);
+	if (readHead == m_CachedWriteHead) {
+		// The buffer looks empty, refresh our view of the write head
+		m_CachedWriteHead = m_WriteHead.load(std::memory_order_acquire);
+		if (readHead == m_CachedWriteHead) {
+			return false;
+		}
+	}
+
+	*outValue = std::move(m_Values[readHead]);
+
+	// Release the slot back to the producer
+	m_ReadHead.store(NextIndex(readHead), std::memory_order_release);
+	return true;
+}
+
+template< typename ValueType, size_t tSize >
+bool SpscRingBuffer<ValueType, tSize>::TryPeek(ValueType* outValue) const {
+
+	if (CanRead() == false) {
+		return false;
+	}
+
+	*outValue = m_Values[m_ReadHead.load(std::memory_order_relaxed)];
+	return true;
+}
+
+template< typename ValueType, size_t tSize >
+bool SpscRingBuffer<ValueType, tSize>::CanRead() const {
+
+	// You can't read where hasn't been written yet
+	return m_ReadHead.load(std::memory_order_relaxed) != m_WriteHead.load(std::memory_order_acquire);
+}
+
+template< typename ValueType, size_t tSize >
+template< typename WriteType,
+	// @Template Condition: links to condition in class definition
+	typename TemplateCondition >
+bool SpscRingBuffer<ValueType, tSize>::TryWrite(WriteType&& writeValue) {
+
+	size_t writeHead = m_WriteHead.load(std::memory_order_relaxed);
+	size_t nextWriteHead = NextIndex(writeHead);
+	if (nextWriteHead == m_CachedReadHead) {
+		// The buffer looks full, refresh our view of the read head
+		m_CachedReadHead = m_ReadHead.load(std::memory_order_acquire);
+		if (nextWriteHead == m_CachedReadHead) {
+			return false;
+		}
+	}
+
+	m_Values[writeHead] = std::forward<WriteType>(writeValue);
+
+	// Publish the value to the consumer
+	m_WriteHead.store(nextWriteHead, std::memory_order_release);
+	return true;
+}
+
+template< typename ValueType, size_t tSize >
+bool SpscRingBuffer<ValueType, tSize>::CanWrite() const {
+
+	// You can't write where hasn't been read yet
+	return NextIndex(m_WriteHead.load(std::memory_order_relaxed)) != m_ReadHead.load(std::memory_order_acquire);
+}
+
+template< typename ValueType, size_t tSize >
+size_t SpscRingBuffer<ValueType, tSize>::Size() const {
+
+	return tSize;
+}
+
+template< typename ValueType, size_t tSize >
+size_t SpscRingBuffer<ValueType, tSize>::NextIndex(size_t index) {
+
+	return (index + 1) % tSize;
+}
+
+MIST_NAMESPACE_END
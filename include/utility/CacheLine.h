@@ -0,0 +1,12 @@
+#pragma once
+
+#include <Mist_Common/include/UtilityMacros.h>
+#include <cstddef>
+
+MIST_NAMESPACE
+
+// The size of a cache line on the platforms we target, values that are written by different threads
+// should be aligned to this size in order to avoid false sharing.
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+MIST_NAMESPACE_END
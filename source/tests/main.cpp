@@ -1,11 +1,19 @@
 #include <Mist_Common/include/UtilityMacros.h>
 
 #include "../../include/data-structures/RingBuffer.h"
+#include "../../include/data-structures/SpscRingBuffer.h"
+#include "../../include/data-structures/MpmcRingBuffer.h"
+#include "../../include/data-structures/DynamicRingBuffer.h"
 #include "../../include/algorithms/Sorting.h"
+#include "../../include/algorithms/ParallelSorting.h"
+#include "../../include/algorithms/ExternalSorting.h"
 #include "../../include/utility/BitManipulations.h"
 #include "../../include/data-structures/SingleList.h"
 #include "../../include/allocators/CppAllocator.h"
+#include "../../include/allocators/LinearAllocator.h"
+#include "../../include/allocators/PoolAllocator.h"
 #include "../../include/data-structures/DynamicArray.h"
+#include "../../include/data-structures/InlineDynamicArray.h"
 
 #include <cassert>
 #include <iostream>
@@ -15,6 +23,10 @@
 #include <limits>
 #include <ctime>
 #include <memory>
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include <atomic>
 
 
 
@@ -156,6 +168,47 @@ void TestRingBuffer() {
 	// Attempt to read more than was written, Assure that it returns false
 	MIST_ASSERT(buffer.TryRead(&result) == false);
 
+	// Assure that batches wrap around the buffer, with and without a power of 2 size
+	Mist::RingBuffer<size_t, 8> maskedBuffer;
+	size_t batch[7] = { 0, 1, 2, 3, 4, 5, 6 };
+	size_t readBatch[7] = {};
+	for (size_t i = 0; i < 5; i++) {
+		MIST_ASSERT(maskedBuffer.TryWriteBatch(batch, 5) == 5);
+		MIST_ASSERT(maskedBuffer.ReadableCount() == 5);
+		MIST_ASSERT(maskedBuffer.TryReadBatch(readBatch, 7) == 5);
+		for (size_t j = 0; j < 5; j++) {
+			MIST_ASSERT(readBatch[j] == j);
+		}
+	}
+	// Assure that we only write what fits
+	MIST_ASSERT(maskedBuffer.TryWriteBatch(batch, 7) == 7);
+	MIST_ASSERT(maskedBuffer.TryWriteBatch(batch, 7) == 0);
+	MIST_ASSERT(maskedBuffer.WritableCount() == 0);
+
+	Mist::RingBuffer<size_t, 6> wrappedBuffer;
+	for (size_t i = 0; i < 5; i++) {
+		MIST_ASSERT(wrappedBuffer.TryWriteBatch(batch, 4) == 4);
+		MIST_ASSERT(wrappedBuffer.TryRead(&result) && result == 0);
+		MIST_ASSERT(wrappedBuffer.TryReadBatch(readBatch, 7) == 3);
+		MIST_ASSERT(readBatch[0] == 1 && readBatch[2] == 3);
+	}
+
+	// Assure that overwriting keeps the newest values
+	Mist::RingBuffer<size_t, 4> telemetryBuffer;
+	for (size_t i = 0; i < 10; i++) {
+		telemetryBuffer.WriteOverwrite(i);
+	}
+	MIST_ASSERT(telemetryBuffer.ReadableCount() == 3);
+
+	size_t newest[4] = {};
+	MIST_ASSERT(telemetryBuffer.CopyNewest(newest, 2) == 2);
+	MIST_ASSERT(newest[0] == 8 && newest[1] == 9);
+	MIST_ASSERT(telemetryBuffer.CopyNewest(newest, 4) == 3);
+	MIST_ASSERT(newest[0] == 7 && newest[1] == 8 && newest[2] == 9);
+
+	// Assure that the snapshot didn't consume anything
+	MIST_ASSERT(telemetryBuffer.TryRead(&result) && result == 7);
+
 	// Notify that the ring buffer tests have passed
 	std::cout << "RingBuffer Tests Passed!" << std::endl;
 
@@ -172,6 +225,162 @@ void TestRingBuffer() {
 	}
 }
 
+void TestSpscRingBuffer() {
+
+	std::cout << "SpscRingBuffer Test" << std::endl;
+
+	Mist::SpscRingBuffer<size_t, 6> buffer;
+	MIST_ASSERT(buffer.Size() == 6);
+	MIST_ASSERT(buffer.CanRead() == false);
+
+	// Assure that the single threaded behaviour matches the ring buffer
+	for (size_t i = 0; i < 5; i++) {
+		MIST_ASSERT(buffer.CanWrite());
+		MIST_ASSERT(buffer.TryWrite(i));
+	}
+	MIST_ASSERT(buffer.CanWrite() == false);
+	MIST_ASSERT(buffer.TryWrite(10) == false);
+
+	size_t result = 0;
+	for (size_t i = 0; i < 5; i++) {
+		size_t peekResult = 0;
+		MIST_ASSERT(buffer.TryPeek(&peekResult));
+		MIST_ASSERT(buffer.TryRead(&result));
+		MIST_ASSERT(peekResult == result && result == i);
+	}
+	MIST_ASSERT(buffer.TryRead(&result) == false);
+
+	// Assure that the values are handed off in order between two threads
+	const size_t HANDOFF_COUNT = 100000;
+	Mist::SpscRingBuffer<size_t, 64> threadBuffer;
+	std::thread producer([&threadBuffer, HANDOFF_COUNT]() {
+		for (size_t i = 0; i < HANDOFF_COUNT; i++) {
+			while (threadBuffer.TryWrite(i) == false) {}
+		}
+	});
+
+	for (size_t i = 0; i < HANDOFF_COUNT; i++) {
+		while (threadBuffer.TryRead(&result) == false) {}
+		MIST_ASSERT(result == i);
+	}
+	producer.join();
+
+	std::cout << "SpscRingBuffer Tests Passed!" << std::endl;
+}
+
+void TestMpmcRingBuffer() {
+
+	std::cout << "MpmcRingBuffer Test" << std::endl;
+
+	Mist::MpmcRingBuffer<size_t, 8> buffer;
+	MIST_ASSERT(buffer.Size() == 8);
+
+	// Assure that every slot can be written to
+	for (size_t i = 0; i < 8; i++) {
+		MIST_ASSERT(buffer.TryWrite(i));
+	}
+	MIST_ASSERT(buffer.TryWrite(10) == false);
+
+	size_t result = 0;
+	for (size_t i = 0; i < 8; i++) {
+		MIST_ASSERT(buffer.TryRead(&result));
+		MIST_ASSERT(result == i);
+	}
+	MIST_ASSERT(buffer.TryRead(&result) == false);
+
+	// Assure that every value written by the producers is read exactly once by the consumers
+	const size_t THREAD_COUNT = 4;
+	const size_t VALUES_PER_THREAD = 50000;
+	Mist::MpmcRingBuffer<size_t, 64> threadBuffer;
+	std::vector<size_t> readCounts(THREAD_COUNT * VALUES_PER_THREAD);
+	std::atomic<size_t> readTotal(0);
+
+	std::vector<std::thread> threads;
+	for (size_t t = 0; t < THREAD_COUNT; t++) {
+		threads.emplace_back([&threadBuffer, t, VALUES_PER_THREAD]() {
+			for (size_t i = 0; i < VALUES_PER_THREAD; i++) {
+				threadBuffer.Write(t * VALUES_PER_THREAD + i);
+			}
+		});
+		threads.emplace_back([&threadBuffer, &readCounts, &readTotal, VALUES_PER_THREAD]() {
+			for (size_t i = 0; i < VALUES_PER_THREAD; i++) {
+				size_t value = 0;
+				threadBuffer.Read(&value);
+				readCounts[value]++;
+				readTotal++;
+			}
+		});
+	}
+
+	for (auto& thread : threads) {
+		thread.join();
+	}
+
+	MIST_ASSERT(readTotal == THREAD_COUNT * VALUES_PER_THREAD);
+	for (auto count : readCounts) {
+		MIST_ASSERT(count == 1);
+	}
+
+	std::cout << "MpmcRingBuffer Tests Passed!" << std::endl;
+}
+
+void TestDynamicRingBuffer() {
+
+	std::cout << "DynamicRingBuffer Test" << std::endl;
+
+	size_t capacity = 5;
+	Mist::DynamicRingBuffer<size_t> buffer(capacity);
+	MIST_ASSERT(buffer.Size() == 5);
+	MIST_ASSERT(buffer.CanRead() == false);
+
+	// Assure that every slot can be written and that the heads wrap around
+	size_t result = 0;
+	for (size_t j = 0; j < 3; j++) {
+		for (size_t i = 0; i < 5; i++) {
+			MIST_ASSERT(buffer.TryWrite(i));
+		}
+		MIST_ASSERT(buffer.TryWrite(10) == false);
+		MIST_ASSERT(buffer.ReadableCount() == 5);
+
+		for (size_t i = 0; i < 3; i++) {
+			size_t peekResult = 0;
+			MIST_ASSERT(buffer.TryPeek(&peekResult));
+			MIST_ASSERT(buffer.TryRead(&result));
+			MIST_ASSERT(peekResult == result && result == i);
+		}
+		MIST_ASSERT(buffer.TryWrite(5) && buffer.TryWrite(6));
+		for (size_t i = 3; i < 7; i++) {
+			MIST_ASSERT(buffer.TryRead(&result) && result == i);
+		}
+		MIST_ASSERT(buffer.TryRead(&result) == false);
+	}
+
+	// Assure that the values are only constructed when written and destroyed when read or when the buffer dies
+	{
+		std::shared_ptr<size_t> tracked = std::make_shared<size_t>(10);
+		Mist::DynamicRingBuffer<std::shared_ptr<size_t>> trackingBuffer(4);
+		MIST_ASSERT(tracked.use_count() == 1);
+
+		trackingBuffer.TryWrite(tracked);
+		trackingBuffer.TryWrite(tracked);
+		MIST_ASSERT(tracked.use_count() == 3);
+
+		std::shared_ptr<size_t> readValue;
+		trackingBuffer.TryRead(&readValue);
+		readValue.reset();
+		MIST_ASSERT(tracked.use_count() == 2);
+
+		Mist::DynamicRingBuffer<std::shared_ptr<size_t>> movedBuffer(std::move(trackingBuffer));
+		MIST_ASSERT(movedBuffer.ReadableCount() == 1);
+		{
+			Mist::DynamicRingBuffer<std::shared_ptr<size_t>> destroyedBuffer(std::move(movedBuffer));
+		}
+		MIST_ASSERT(tracked.use_count() == 1);
+	}
+
+	std::cout << "DynamicRingBuffer Tests Passed!" << std::endl;
+}
+
 void TestSorting() {
 	const size_t SORTING_ITERATIONS = 100;
 	const size_t ELEMENT_COUNT = 100;
@@ -213,6 +422,213 @@ void TestSorting() {
 	}
 	std::cout << totalSortTime << "ms" << std::endl;
 
+	// Assure that merge sort handles collections that don't split evenly into blocks
+	for (size_t j = 1; j < ELEMENT_COUNT; j++) {
+		for (size_t i = 0; i < j; i++) {
+			arr[i] = rand() % ELEMENT_COUNT;
+		}
+		Mist::MergeSort(&arr[0], &arr[0] + j);
+		MIST_ASSERT(Mist::IsSorted(&arr[0], &arr[0] + j));
+	}
+
+	// Assure that merge sort is stable and reuses a working area provided by the caller
+	{
+		struct KeyedValue {
+			size_t m_Key;
+			size_t m_Index;
+		};
+
+		std::vector<KeyedValue> workingArea(ELEMENT_COUNT);
+		for (size_t j = 0; j < SORTING_ITERATIONS; j++) {
+			std::vector<KeyedValue> keyedValues;
+			for (size_t i = 0; i < ELEMENT_COUNT; i++) {
+				keyedValues.push_back({ (size_t)(rand() % 10), i });
+			}
+
+			Mist::MergeSort(keyedValues.data(), keyedValues.data() + keyedValues.size(), workingArea.data(), Mist::Less(),
+				[](const KeyedValue& value) { return value.m_Key; });
+			for (size_t i = 1; i < keyedValues.size(); i++) {
+				MIST_ASSERT(keyedValues[i - 1].m_Key < keyedValues[i].m_Key
+					|| (keyedValues[i - 1].m_Key == keyedValues[i].m_Key && keyedValues[i - 1].m_Index < keyedValues[i].m_Index));
+			}
+		}
+	}
+
+	// Assure that merge sort can allocate it's working area from an allocator
+	{
+		Mist::LinearArena arena(sizeof(size_t) * ELEMENT_COUNT * 2);
+		Mist::LinearArenaAllocator arenaAllocator(&arena);
+
+		for (size_t i = 0; i < ELEMENT_COUNT; i++) {
+			arr[i] = rand() % ELEMENT_COUNT;
+		}
+		Mist::MergeSort(&arr[0], &arr[0] + ELEMENT_COUNT, arenaAllocator);
+		MIST_ASSERT(Mist::IsSorted(std::begin(arr), std::end(arr)));
+		// The working area is released once the sort is done
+		MIST_ASSERT(arena.UsedSize() == 0);
+	}
+
+	// Assure that merge sort only moves the values
+	{
+		std::vector<std::unique_ptr<size_t>> uniqueValues;
+		for (size_t i = 0; i < ELEMENT_COUNT; i++) {
+			uniqueValues.push_back(std::unique_ptr<size_t>(new size_t(rand() % ELEMENT_COUNT)));
+		}
+
+		auto dereference = [](const std::unique_ptr<size_t>& value) { return *value; };
+		Mist::MergeSort(&uniqueValues, Mist::Less(), dereference);
+		MIST_ASSERT(Mist::IsSorted(std::begin(uniqueValues), std::end(uniqueValues), Mist::Less(), dereference));
+	}
+
+	std::cout << "Tim Sort" << std::endl;
+
+	totalSortTime = 0.0;
+	// Run the simulation multiple times
+	for (size_t j = 0; j < SORTING_ITERATIONS; j++) {
+		// clear the vector and restart
+		m.clear();
+		for (size_t i = 0; i < ELEMENT_COUNT; i++) {
+			m.push_back(rand() % ELEMENT_COUNT);
+		}
+
+		BeginTimer();
+		Mist::TimSort(&m);
+		totalSortTime += EndTimer();
+
+		MIST_ASSERT(Mist::IsSorted(std::begin(m), std::end(m)));
+	}
+
+	std::cout << totalSortTime << "ms" << std::endl;
+
+	// Assure that tim sort is stable on mostly sorted values, with both ascending and descending runs
+	{
+		struct KeyedValue {
+			size_t m_Key;
+			size_t m_Index;
+		};
+
+		const size_t RUN_ELEMENT_COUNT = 5000;
+		std::vector<KeyedValue> keyedValues;
+		for (size_t i = 0; i < RUN_ELEMENT_COUNT; i++) {
+			size_t key = i < RUN_ELEMENT_COUNT / 2 ? i / 4 : (RUN_ELEMENT_COUNT - i) / 4;
+			keyedValues.push_back({ rand() % 20 == 0 ? (size_t)(rand() % RUN_ELEMENT_COUNT) : key, i });
+		}
+
+		Mist::TimSort(&keyedValues, Mist::Less(), [](const KeyedValue& value) { return value.m_Key; });
+		for (size_t i = 1; i < keyedValues.size(); i++) {
+			MIST_ASSERT(keyedValues[i - 1].m_Key < keyedValues[i].m_Key
+				|| (keyedValues[i - 1].m_Key == keyedValues[i].m_Key && keyedValues[i - 1].m_Index < keyedValues[i].m_Index));
+		}
+	}
+
+	std::cout << "Parallel Merge Sort" << std::endl;
+
+	{
+		const size_t PARALLEL_ELEMENT_COUNT = 100000;
+		std::vector<size_t> parallelValues(PARALLEL_ELEMENT_COUNT);
+		for (auto& value : parallelValues) {
+			value = rand() % PARALLEL_ELEMENT_COUNT;
+		}
+		std::vector<size_t> expectedValues = parallelValues;
+		std::sort(expectedValues.begin(), expectedValues.end());
+
+		BeginTimer();
+		Mist::ParallelMergeSort(parallelValues.data(), parallelValues.data() + parallelValues.size(), 5);
+		std::cout << EndTimer() << "ms" << std::endl;
+		MIST_ASSERT(parallelValues == expectedValues);
+	}
+
+	std::cout << "Merge Sorted Runs" << std::endl;
+
+	// Assure that merging the runs matches a stable sort of the runs put end to end, in one go, in chunks and in parallel
+	{
+		const size_t RUN_COUNT = 7;
+		const size_t RUN_ELEMENT_COUNT = 10000;
+		std::vector<std::vector<std::pair<size_t, size_t>>> runs(RUN_COUNT);
+		std::vector<std::pair<size_t, size_t>> expectedValues;
+		for (size_t run = 0; run < RUN_COUNT; run++) {
+			// Leave one run empty
+			size_t runSize = run == 3 ? 0 : RUN_ELEMENT_COUNT + rand() % 100;
+			for (size_t i = 0; i < runSize; i++) {
+				runs[run].push_back({ static_cast<size_t>(rand() % 100), expectedValues.size() });
+				expectedValues.push_back(runs[run].back());
+			}
+			std::stable_sort(runs[run].begin(), runs[run].end(), [](const std::pair<size_t, size_t>& left, const std::pair<size_t, size_t>& right) {
+				return left.first < right.first;
+			});
+		}
+		// The values are unique and still in the order of their runs
+		std::sort(expectedValues.begin(), expectedValues.end(), [](const std::pair<size_t, size_t>& left, const std::pair<size_t, size_t>& right) {
+			return left.first < right.first || (left.first == right.first && left.second < right.second);
+		});
+
+		auto byKey = [](const std::pair<size_t, size_t>& value) { return value.first; };
+
+		std::vector<std::pair<size_t, size_t>> mergedValues;
+		Mist::MergeSortedRuns(runs, std::back_inserter(mergedValues), Mist::Less(), byKey);
+		MIST_ASSERT(mergedValues == expectedValues);
+
+		using RunIterator = std::vector<std::pair<size_t, size_t>>::const_iterator;
+		Mist::SortedRunMerger<RunIterator, Mist::Less, decltype(byKey)> merger(Mist::Less(), byKey);
+		for (const auto& run : runs) {
+			merger.AddRun(run.begin(), run.end());
+		}
+		std::vector<std::pair<size_t, size_t>> chunkedValues;
+		std::pair<size_t, size_t> chunk[100];
+		while (size_t count = merger.Merge(chunk, 100)) {
+			chunkedValues.insert(chunkedValues.end(), chunk, chunk + count);
+		}
+		MIST_ASSERT(merger.IsDone());
+		MIST_ASSERT(chunkedValues == expectedValues);
+
+		std::vector<std::pair<size_t, size_t>> parallelValues(expectedValues.size());
+		Mist::ParallelMergeSortedRuns(runs, parallelValues.begin(), 5, Mist::ThreadExecutor(), Mist::Less(), byKey);
+		MIST_ASSERT(parallelValues == expectedValues);
+	}
+
+	std::cout << "Arg Sort" << std::endl;
+
+	// Assure that applying the order of an arg sort matches a stable sort, for the records and an array parallel to them
+	{
+		struct LargeRecord {
+			size_t m_Key;
+			size_t m_Index;
+			char m_Payload[184];
+		};
+
+		const size_t RECORD_COUNT = 10000;
+		std::vector<LargeRecord> records(RECORD_COUNT);
+		std::vector<size_t> recordIndices(RECORD_COUNT);
+		for (size_t i = 0; i < RECORD_COUNT; i++) {
+			records[i].m_Key = rand() % 100;
+			records[i].m_Index = i;
+			records[i].m_Payload[0] = static_cast<char>(i);
+			recordIndices[i] = i;
+		}
+
+		auto byKey = [](const LargeRecord& record) { return record.m_Key; };
+		std::vector<LargeRecord> expectedRecords = records;
+		std::stable_sort(expectedRecords.begin(), expectedRecords.end(), [](const LargeRecord& left, const LargeRecord& right) {
+			return left.m_Key < right.m_Key;
+		});
+
+		std::vector<uint32_t> order(RECORD_COUNT);
+		Mist::ArgSort(records, order.data(), Mist::Less(), byKey);
+		Mist::ApplyPermutation(order.data(), order.size(), records.begin(), recordIndices.data());
+		for (size_t i = 0; i < RECORD_COUNT; i++) {
+			MIST_ASSERT(records[i].m_Key == expectedRecords[i].m_Key);
+			MIST_ASSERT(records[i].m_Index == expectedRecords[i].m_Index);
+			MIST_ASSERT(records[i].m_Payload[0] == static_cast<char>(expectedRecords[i].m_Index));
+			MIST_ASSERT(recordIndices[i] == expectedRecords[i].m_Index);
+		}
+
+		// A descending order with the default projection
+		std::vector<int> values = { 5, 1, 4, 1, 3 };
+		std::vector<size_t> valueOrder(values.size());
+		Mist::ArgSort(values.begin(), values.end(), valueOrder.data(), [](int left, int right) { return left > right; });
+		MIST_ASSERT((valueOrder == std::vector<size_t>{ 0, 2, 4, 1, 3 }));
+	}
+
 	std::cout << "Quick Sort" << std::endl;
 
 	
@@ -243,6 +659,143 @@ void TestSorting() {
 
 	std::cout << totalSortTime << "ms" << std::endl;
 
+	// Assure that the inputs that degrade a naive quick sort are still sorted
+	{
+		const size_t PATTERN_ELEMENT_COUNT = 10000;
+		std::vector<size_t> patternValues(PATTERN_ELEMENT_COUNT);
+
+		// Already sorted
+		for (size_t i = 0; i < PATTERN_ELEMENT_COUNT; i++) {
+			patternValues[i] = i;
+		}
+		Mist::QuickSort(&patternValues);
+		MIST_ASSERT(Mist::IsSorted(std::begin(patternValues), std::end(patternValues)));
+
+		// Reverse sorted
+		for (size_t i = 0; i < PATTERN_ELEMENT_COUNT; i++) {
+			patternValues[i] = PATTERN_ELEMENT_COUNT - i;
+		}
+		Mist::QuickSort(&patternValues);
+		MIST_ASSERT(Mist::IsSorted(std::begin(patternValues), std::end(patternValues)));
+
+		// Only a few distinct values
+		for (size_t i = 0; i < PATTERN_ELEMENT_COUNT; i++) {
+			patternValues[i] = rand() % 3;
+		}
+		Mist::QuickSort(&patternValues);
+		MIST_ASSERT(Mist::IsSorted(std::begin(patternValues), std::end(patternValues)));
+
+		// Organ pipe
+		for (size_t i = 0; i < PATTERN_ELEMENT_COUNT; i++) {
+			patternValues[i] = i < PATTERN_ELEMENT_COUNT / 2 ? i : PATTERN_ELEMENT_COUNT - i;
+		}
+		Mist::QuickSort(&patternValues);
+		MIST_ASSERT(Mist::IsSorted(std::begin(patternValues), std::end(patternValues)));
+	}
+
+	std::cout << "Sorting Networks" << std::endl;
+
+	// Assure that every network size matches a full sort, including the extremes that double as padding
+	{
+		for (size_t count = 0; count <= Mist::Detail::SORTING_NETWORK_MAXIMUM_SIZE; count++) {
+			for (size_t j = 0; j < 50; j++) {
+
+				std::vector<int32_t> intValues(count);
+				std::vector<uint64_t> unsignedValues(count);
+				std::vector<float> floatValues(count);
+				for (size_t i = 0; i < count; i++) {
+					switch (rand() % 8) {
+					case 0:
+						intValues[i] = std::numeric_limits<int32_t>::max();
+						unsignedValues[i] = std::numeric_limits<uint64_t>::max();
+						floatValues[i] = std::numeric_limits<float>::infinity();
+						break;
+					case 1:
+						intValues[i] = std::numeric_limits<int32_t>::min();
+						unsignedValues[i] = 0;
+						floatValues[i] = -std::numeric_limits<float>::infinity();
+						break;
+					default:
+						intValues[i] = rand() % 64 - 32;
+						unsignedValues[i] = (static_cast<uint64_t>(rand()) << 33) ^ static_cast<uint64_t>(rand());
+						floatValues[i] = static_cast<float>(rand() % 64 - 32) * 0.5f;
+						break;
+					}
+				}
+
+				std::vector<int32_t> expectedIntValues = intValues;
+				std::vector<uint64_t> expectedUnsignedValues = unsignedValues;
+				std::vector<float> expectedFloatValues = floatValues;
+				std::sort(expectedIntValues.begin(), expectedIntValues.end());
+				std::sort(expectedUnsignedValues.begin(), expectedUnsignedValues.end());
+				std::sort(expectedFloatValues.begin(), expectedFloatValues.end());
+
+				Mist::NetworkSort(intValues.data(), intValues.data() + count);
+				Mist::NetworkSort(unsignedValues.data(), unsignedValues.data() + count);
+				Mist::NetworkSort(floatValues.data(), floatValues.data() + count);
+				MIST_ASSERT(intValues == expectedIntValues);
+				MIST_ASSERT(unsignedValues == expectedUnsignedValues);
+				MIST_ASSERT(floatValues == expectedFloatValues);
+			}
+		}
+
+		// The sorts that finish their small ranges with a network
+		std::vector<int32_t> networkValues(ELEMENT_COUNT);
+		for (size_t i = 0; i < ELEMENT_COUNT; i++) {
+			networkValues[i] = rand() % 1000 - 500;
+		}
+		std::vector<int32_t> mergeSortedValues = networkValues;
+		Mist::QuickSort(&networkValues);
+		Mist::MergeSort(&mergeSortedValues);
+		MIST_ASSERT(Mist::IsSorted(std::begin(networkValues), std::end(networkValues)));
+		MIST_ASSERT(networkValues == mergeSortedValues);
+	}
+
+	std::cout << "Heap Sort" << std::endl;
+
+	totalSortTime = 0.0;
+	// Run the simulation multiple times
+	for (size_t j = 0; j < SORTING_ITERATIONS; j++) {
+		// clear the vector and restart
+		m.clear();
+		for (size_t i = 0; i < ELEMENT_COUNT; i++) {
+			m.push_back(rand() % ELEMENT_COUNT);
+		}
+
+		BeginTimer();
+		Mist::HeapSort(&m);
+		totalSortTime += EndTimer();
+
+		MIST_ASSERT(Mist::IsSorted(std::begin(m), std::end(m)));
+	}
+
+	std::cout << totalSortTime << "ms" << std::endl;
+
+	// Assure that the top k and the nth value match a full sort
+	{
+		const size_t TOP_COUNT = 10;
+		std::vector<size_t> values;
+		for (size_t i = 0; i < ELEMENT_COUNT; i++) {
+			values.push_back(rand() % ELEMENT_COUNT);
+		}
+		std::vector<size_t> expectedValues = values;
+		std::sort(expectedValues.begin(), expectedValues.end());
+
+		std::vector<size_t> partialValues = values;
+		Mist::PartialSort(partialValues.begin(), partialValues.begin() + TOP_COUNT, partialValues.end());
+		MIST_ASSERT(std::equal(partialValues.begin(), partialValues.begin() + TOP_COUNT, expectedValues.begin()));
+
+		for (size_t nth = 0; nth < ELEMENT_COUNT; nth += 7) {
+			std::vector<size_t> selectedValues = values;
+			Mist::NthElement(selectedValues.begin(), selectedValues.begin() + nth, selectedValues.end());
+			MIST_ASSERT(selectedValues[nth] == expectedValues[nth]);
+			for (size_t i = 0; i < ELEMENT_COUNT; i++) {
+				MIST_ASSERT(i >= nth || selectedValues[i] <= selectedValues[nth]);
+				MIST_ASSERT(i <= nth || selectedValues[i] >= selectedValues[nth]);
+			}
+		}
+	}
+
 	std::cout << "Insertion Sort" << std::endl;
 
 	totalSortTime = 0.0;
@@ -271,6 +824,25 @@ void TestSorting() {
 
 	std::cout << totalSortTime << "ms" << std::endl;
 
+	// Assure that a batch can be inserted into a DynamicArray, including an empty one
+	{
+		Mist::DynamicArray<size_t> sortedArray;
+		std::vector<size_t> expectedValues;
+		for (size_t j = 0; j < 10; j++) {
+			std::vector<size_t> batch;
+			for (size_t i = 0; i < ELEMENT_COUNT; i++) {
+				batch.push_back(rand() % ELEMENT_COUNT);
+			}
+
+			Mist::InsertionSort(batch, &sortedArray);
+			expectedValues.insert(expectedValues.end(), batch.begin(), batch.end());
+			std::sort(expectedValues.begin(), expectedValues.end());
+
+			MIST_ASSERT(sortedArray.Size() == expectedValues.size());
+			MIST_ASSERT(std::equal(sortedArray.begin(), sortedArray.end(), expectedValues.begin()));
+		}
+	}
+
 	std::cout << "Bucket Sort" << std::endl;
 
 
@@ -280,8 +852,14 @@ void TestSorting() {
 	}
 
 	// quick sort the vector
-	Mist::BucketSort(std::begin(arr), std::end(arr), (size_t)10, ELEMENT_COUNT + 10);
+	size_t expectedArr[ELEMENT_COUNT];
+	std::copy(std::begin(arr), std::end(arr), std::begin(expectedArr));
+	std::sort(std::begin(expectedArr), std::end(expectedArr));
+
+	// The range is inclusive, the maximum value has it's own bucket
+	Mist::BucketSort(std::begin(arr), std::end(arr), (size_t)10, ELEMENT_COUNT + 9);
 	MIST_ASSERT(Mist::IsSorted(std::begin(arr), std::end(arr)));
+	MIST_ASSERT(std::equal(std::begin(arr), std::end(arr), std::begin(expectedArr)));
 
 	totalSortTime = 0.0;
 	// Run the simulation multiple times
@@ -302,9 +880,216 @@ void TestSorting() {
 
 	std::cout << totalSortTime << "ms" << std::endl;
 
+	// Assure that bucket sort can stably sort values by a small key, on one or multiple tasks
+	{
+		struct Particle {
+			uint8_t m_MaterialId;
+			size_t m_Index;
+		};
+
+		auto materialId = [](const Particle& particle) { return particle.m_MaterialId; };
+		auto assureStable = [](const std::vector<Particle>& particles) {
+			for (size_t i = 1; i < particles.size(); i++) {
+				MIST_ASSERT(particles[i - 1].m_MaterialId < particles[i].m_MaterialId
+					|| (particles[i - 1].m_MaterialId == particles[i].m_MaterialId && particles[i - 1].m_Index < particles[i].m_Index));
+			}
+		};
+
+		const size_t PARTICLE_COUNT = 50000;
+		std::vector<Particle> particles;
+		for (size_t i = 0; i < PARTICLE_COUNT; i++) {
+			particles.push_back({ (uint8_t)(rand() % 256), i });
+		}
+
+		std::vector<Particle> sortedParticles = particles;
+		Mist::BucketSort(&sortedParticles, (uint8_t)0, (uint8_t)255, materialId);
+		assureStable(sortedParticles);
+
+		sortedParticles = particles;
+		Mist::ParallelBucketSort(sortedParticles.data(), sortedParticles.data() + sortedParticles.size(), 4, Mist::ThreadExecutor(),
+			(uint8_t)0, (uint8_t)255, materialId);
+		assureStable(sortedParticles);
+
+		// Negative keys are offset by the minimum
+		std::vector<int> signedValues;
+		for (size_t i = 0; i < ELEMENT_COUNT; i++) {
+			signedValues.push_back(rand() % 21 - 10);
+		}
+		Mist::BucketSort(&signedValues, -10, 10);
+		MIST_ASSERT(Mist::IsSorted(std::begin(signedValues), std::end(signedValues)));
+		MIST_ASSERT(signedValues.front() >= -10 && signedValues.back() <= 10);
+	}
+
+	std::cout << "Comparators and Projections" << std::endl;
+
+	// Assure that every sort can order the values with a comparator and a projection
+	{
+		struct Particle {
+			float m_Depth;
+			size_t m_Index;
+		};
+
+		auto byDepth = [](const Particle& particle) { return particle.m_Depth; };
+
+		std::vector<Particle> particles;
+		for (size_t i = 0; i < ELEMENT_COUNT; i++) {
+			particles.push_back({ (float)(rand() % ELEMENT_COUNT), i });
+		}
+
+		std::vector<Particle> sortedParticles = particles;
+		Mist::MergeSort(&sortedParticles, std::less<float>(), byDepth);
+		MIST_ASSERT(Mist::IsSorted(std::begin(sortedParticles), std::end(sortedParticles), std::less<float>(), byDepth));
+
+		sortedParticles = particles;
+		Mist::MergeSort(sortedParticles.data(), sortedParticles.data() + sortedParticles.size(), std::greater<float>(), byDepth);
+		MIST_ASSERT(Mist::IsSorted(std::begin(sortedParticles), std::end(sortedParticles), std::greater<float>(), byDepth));
+
+		sortedParticles = particles;
+		Mist::QuickSort(&sortedParticles, std::greater<float>(), byDepth);
+		MIST_ASSERT(Mist::IsSorted(std::begin(sortedParticles), std::end(sortedParticles), std::greater<float>(), byDepth));
+
+		sortedParticles = particles;
+		Mist::ParallelMergeSort(sortedParticles.data(), sortedParticles.data() + sortedParticles.size(), 2, Mist::ThreadExecutor(), std::less<float>(), byDepth);
+		MIST_ASSERT(Mist::IsSorted(std::begin(sortedParticles), std::end(sortedParticles), std::less<float>(), byDepth));
+
+		sortedParticles = particles;
+		Mist::ParallelMergeSort(sortedParticles.data(), sortedParticles.data() + sortedParticles.size(), 2, std::greater<float>(), byDepth);
+		MIST_ASSERT(Mist::IsSorted(std::begin(sortedParticles), std::end(sortedParticles), std::greater<float>(), byDepth));
+
+		// Sort an index buffer by the values it points to without touching the values
+		std::vector<size_t> indices;
+		for (size_t i = 0; i < particles.size(); i++) {
+			indices.push_back(i);
+		}
+		auto indexDepth = [&particles](size_t index) { return particles[index].m_Depth; };
+		Mist::QuickSort(&indices, std::less<float>(), indexDepth);
+		MIST_ASSERT(Mist::IsSorted(std::begin(indices), std::end(indices), std::less<float>(), indexDepth));
+
+		// Insert into a collection sorted in descending order
+		std::vector<size_t> descending = { 9, 7, 5, 3, 1 };
+		Mist::InsertionSort(std::vector<size_t>{ 8, 0, 4, 10 }, &descending, std::greater<size_t>());
+		MIST_ASSERT(Mist::IsSorted(std::begin(descending), std::end(descending), std::greater<size_t>()));
+		MIST_ASSERT(descending.size() == 9);
+	}
+
+	std::cout << "Radix Sort" << std::endl;
+
+	totalSortTime = 0.0;
+	// Run the simulation multiple times
+	for (size_t j = 0; j < SORTING_ITERATIONS; j++) {
+		// clear the vector and restart
+		m.clear();
+		for (size_t i = 0; i < ELEMENT_COUNT; i++) {
+			m.push_back(rand());
+		}
+
+		BeginTimer();
+		Mist::RadixSort(&m);
+		totalSortTime += EndTimer();
+
+		MIST_ASSERT(Mist::IsSorted(std::begin(m), std::end(m)));
+	}
+
+	std::cout << totalSortTime << "ms" << std::endl;
+
+	// Assure that negative integers and floats are sorted below the positive values
+	{
+		std::vector<int> signedValues;
+		std::vector<float> floatValues;
+		for (size_t i = 0; i < ELEMENT_COUNT; i++) {
+			signedValues.push_back(rand() - RAND_MAX / 2);
+			floatValues.push_back((float)(rand() - RAND_MAX / 2) * 0.25f);
+		}
+
+		Mist::RadixSort(&signedValues);
+		MIST_ASSERT(Mist::IsSorted(std::begin(signedValues), std::end(signedValues)));
+
+		Mist::RadixSort(&floatValues);
+		MIST_ASSERT(Mist::IsSorted(std::begin(floatValues), std::end(floatValues)));
+	}
+
+	// Assure that sorting by a key keeps the values with equal keys in their original order
+	{
+		struct KeyedValue {
+			uint64_t m_Key;
+			size_t m_Index;
+		};
+
+		std::vector<KeyedValue> keyedValues;
+		for (size_t i = 0; i < ELEMENT_COUNT; i++) {
+			keyedValues.push_back({ (uint64_t)(rand() % 10), i });
+		}
+
+		Mist::RadixSort(keyedValues.data(), keyedValues.data() + keyedValues.size(), [](const KeyedValue& value) { return value.m_Key; });
+		for (size_t i = 1; i < keyedValues.size(); i++) {
+			MIST_ASSERT(keyedValues[i - 1].m_Key < keyedValues[i].m_Key
+				|| (keyedValues[i - 1].m_Key == keyedValues[i].m_Key && keyedValues[i - 1].m_Index < keyedValues[i].m_Index));
+		}
+	}
+
 	std::cout << "Sorting Tests Passed!" << std::endl;
 }
 
+void TestExternalSort() {
+
+	std::cout << "External Sort Test" << std::endl;
+
+	struct AssetRecord {
+		uint64_t m_Hash;
+		uint64_t m_Offset;
+	};
+
+	const size_t RECORD_COUNT = 100000;
+	// A budget this small produces more runs than can be merged at once, which also tests the intermediate merges
+	const size_t MEMORY_BUDGET = 64 * 1024;
+
+	std::vector<AssetRecord> records;
+	for (size_t i = 0; i < RECORD_COUNT; i++) {
+		records.push_back({ (uint64_t)rand() * (uint64_t)rand(), i });
+	}
+
+	FILE* input = tmpfile();
+	FILE* output = tmpfile();
+	MIST_ASSERT(input != nullptr && output != nullptr);
+	fwrite(records.data(), sizeof(AssetRecord), records.size(), input);
+	rewind(input);
+
+	BeginTimer();
+	bool hasSorted = Mist::ExternalSort<AssetRecord>(input, output, MEMORY_BUDGET, Mist::Less(),
+		[](const AssetRecord& record) { return record.m_Hash; });
+	std::cout << EndTimer() << "ms" << std::endl;
+	MIST_ASSERT(hasSorted);
+
+	// Every record must have made it to the output, in order
+	std::vector<AssetRecord> sortedRecords(RECORD_COUNT + 1);
+	rewind(output);
+	size_t sortedCount = fread(sortedRecords.data(), sizeof(AssetRecord), sortedRecords.size(), output);
+	MIST_ASSERT(sortedCount == RECORD_COUNT);
+	sortedRecords.resize(sortedCount);
+
+	uint64_t offsetSum = 0;
+	for (size_t i = 0; i < sortedRecords.size(); i++) {
+		MIST_ASSERT(i == 0 || sortedRecords[i - 1].m_Hash <= sortedRecords[i].m_Hash);
+		offsetSum += sortedRecords[i].m_Offset;
+	}
+	MIST_ASSERT(offsetSum == (uint64_t)RECORD_COUNT * (RECORD_COUNT - 1) / 2);
+
+	fclose(input);
+	fclose(output);
+
+	// An input that ends in the middle of a record can't be sorted
+	input = tmpfile();
+	output = tmpfile();
+	fwrite(records.data(), sizeof(AssetRecord) / 2, 3, input);
+	rewind(input);
+	MIST_ASSERT(Mist::ExternalSort<AssetRecord>(input, output, MEMORY_BUDGET, Mist::Less(),
+		[](const AssetRecord& record) { return record.m_Hash; }) == false);
+	fclose(input);
+	fclose(output);
+
+	std::cout << "External Sort Tests Passed!" << std::endl;
+}
+
 void TestBitManipulations() {
 	Mist::BitField mask = 0;
 	// All the bits in the mask should be set, thus it's value should be max value
@@ -485,6 +1270,135 @@ void TestAllocator()
 	std::cout << "Cpp Allocator Tests passed" << std::endl;
 }
 
+void TestLinearAllocator() {
+
+	std::cout << "Linear Allocator Tests" << std::endl;
+
+	Mist::LinearArena arena(1024);
+	MIST_ASSERT(arena.Capacity() == 1024);
+	MIST_ASSERT(arena.UsedSize() == 0);
+
+	size_t* value = arena.Alloc<size_t>(5);
+	MIST_ASSERT(value != nullptr && *value == 5);
+	// Assure that the allocations are aligned
+	MIST_ASSERT((size_t)value % alignof(size_t) == 0);
+
+	void* block = arena.Alloc(100);
+	*(size_t*)block = 10;
+	size_t usedSize = arena.UsedSize();
+
+	// Assure that the last block grows in place
+	void* grownBlock = arena.Realloc(block, 200);
+	MIST_ASSERT(grownBlock == block);
+	MIST_ASSERT(*(size_t*)grownBlock == 10);
+	MIST_ASSERT(arena.UsedSize() == usedSize + 100);
+
+	// Assure that a block that isn't last gets moved and copied
+	void* otherBlock = arena.Alloc(16);
+	void* movedBlock = arena.Realloc(grownBlock, 300);
+	MIST_ASSERT(movedBlock != grownBlock);
+	MIST_ASSERT(*(size_t*)movedBlock == 10);
+
+	// Assure that freeing the last block gives back it's memory
+	usedSize = arena.UsedSize();
+	void* lastBlock = arena.Alloc(64);
+	arena.Free(lastBlock);
+	MIST_ASSERT(arena.UsedSize() == usedSize);
+	arena.Free(otherBlock);
+
+	arena.Reset();
+	MIST_ASSERT(arena.UsedSize() == 0);
+
+	// Assure that the static allocator works with the containers
+	struct TestTag {};
+	using TestAllocator = Mist::LinearAllocator<4096, TestTag>;
+	{
+		Mist::DynamicArray<size_t, TestAllocator> testArray;
+		for (size_t i = 0; i < 100; i++) {
+			testArray.InsertAsLast(i);
+		}
+		for (size_t i = 0; i < 100; i++) {
+			MIST_ASSERT(testArray[i] == i);
+		}
+		MIST_ASSERT(TestAllocator::UsedSize() > 0);
+	}
+	TestAllocator::Reset();
+	MIST_ASSERT(TestAllocator::UsedSize() == 0);
+
+	// Assure that containers can be pointed at their own arena
+	{
+		Mist::LinearArena levelArena(4096);
+		Mist::LinearArenaAllocator levelAllocator(&levelArena);
+		Mist::DynamicArray<size_t, Mist::LinearArenaAllocator> levelArray(levelAllocator);
+		Mist::SingleList<size_t, Mist::LinearArenaAllocator> levelList(levelAllocator);
+		MIST_ASSERT(levelArray.GetAllocator().GetArena() == &levelArena);
+
+		for (size_t i = 0; i < 10; i++) {
+			levelArray.InsertAsLast(i);
+			levelList.InsertAsLast(i);
+		}
+		MIST_ASSERT(levelArena.UsedSize() > 0);
+		MIST_ASSERT(levelArray[9] == 9 && *levelList.LastValue() == 9);
+
+		// Assure that the allocator follows it's memory when moved
+		Mist::DynamicArray<size_t, Mist::LinearArenaAllocator> movedArray(std::move(levelArray));
+		MIST_ASSERT(movedArray.GetAllocator().GetArena() == &levelArena);
+		MIST_ASSERT(movedArray[9] == 9);
+	}
+
+	// Assure that stateless allocators don't add to the size of the containers
+	MIST_ASSERT(sizeof(Mist::DynamicArray<size_t>) == sizeof(void*) + sizeof(size_t) * 2);
+	MIST_ASSERT(sizeof(Mist::SingleList<size_t>) == sizeof(void*) * 2);
+
+	std::cout << "Linear Allocator Tests passed" << std::endl;
+}
+
+void TestPoolAllocator() {
+
+	std::cout << "Pool Allocator Tests" << std::endl;
+
+	Mist::PoolArena pool(sizeof(size_t), 4);
+	MIST_ASSERT(pool.BlockSize() >= sizeof(size_t));
+	MIST_ASSERT(pool.ChunkCount() == 0);
+
+	size_t* values[8];
+	for (size_t i = 0; i < 8; i++) {
+		values[i] = pool.Alloc<size_t>(i);
+	}
+	MIST_ASSERT(pool.ChunkCount() == 2);
+
+	// Assure that the blocks of a chunk are contiguous
+	MIST_ASSERT((char*)values[1] - (char*)values[0] == (ptrdiff_t)pool.BlockSize());
+	for (size_t i = 0; i < 8; i++) {
+		MIST_ASSERT(*values[i] == i);
+	}
+
+	// Assure that freed blocks get reused before allocating a new chunk
+	pool.Free(values[3]);
+	size_t* reused = pool.Alloc<size_t>(30);
+	MIST_ASSERT(reused == values[3]);
+	MIST_ASSERT(pool.ChunkCount() == 2);
+
+	// Assure that the pool allocator works with the single list
+	Mist::SingleList<size_t, Mist::PoolAllocator<16>> list;
+	for (size_t i = 0; i < 100; i++) {
+		list.InsertAsLast(i);
+	}
+	list.InsertAsFirst(0);
+	list.Remove(list.FirstNode());
+	MIST_ASSERT(list.Size() == 100);
+
+	size_t expected = 0;
+	for (auto& i : list) {
+		MIST_ASSERT(*i.GetValue() == expected++);
+	}
+
+	list.Clear();
+	MIST_ASSERT(list.Size() == 0);
+
+	std::cout << "Pool Allocator Tests passed" << std::endl;
+}
+
 void TestDynamicArray() {
 
 	std::cout << "Testing Dynamic Array" << std::endl;
@@ -575,19 +1489,175 @@ void TestDynamicArray() {
 
 
 
+	{
+		// Assure that the growth policies determine the reserved size
+		Mist::DynamicArray<size_t> geometricArray;
+		Mist::DynamicArray<size_t, Mist::CppAllocator, Mist::FixedGrowthPolicy<5>> fixedArray;
+		for (size_t i = 0; i < 9; i++) {
+			geometricArray.InsertAsLast(i);
+			fixedArray.InsertAsLast(i);
+		}
+		MIST_ASSERT(geometricArray.ReservedSize() == 16);
+		MIST_ASSERT(fixedArray.ReservedSize() == 10);
+
+		// Assure that the geometric growth doesn't overflow for huge capacities
+		const size_t hugeCapacity = SIZE_MAX / 2 + 1;
+		MIST_ASSERT(Mist::DoubleGrowthPolicy()(hugeCapacity, hugeCapacity + 1) == hugeCapacity + 1);
+
+		struct TripleGrowthPolicy {
+			size_t operator()(size_t currentCapacity, size_t requiredCapacity) const {
+				return currentCapacity * 3 > requiredCapacity ? currentCapacity * 3 : requiredCapacity;
+			}
+		};
+
+		Mist::DynamicArray<size_t, Mist::CppAllocator, TripleGrowthPolicy> customArray;
+		for (size_t i = 0; i < 4; i++) {
+			customArray.InsertAsLast(i);
+		}
+		MIST_ASSERT(customArray.ReservedSize() == 9);
+		for (size_t i = 0; i < 4; i++) {
+			MIST_ASSERT(customArray[i] == i);
+		}
+	}
+
+	{
+		// Assure that ranges get inserted in bulk
+		size_t values[] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+		Mist::DynamicArray<size_t> rangeArray;
+		rangeArray.InsertRange(std::begin(values), std::end(values));
+		MIST_ASSERT(rangeArray.Size() == 8);
+
+		std::list<size_t> valueList(std::begin(values), std::end(values));
+		rangeArray.InsertRange(valueList.begin(), valueList.end());
+		MIST_ASSERT(rangeArray.Size() == 16);
+		for (size_t i = 0; i < 16; i++) {
+			MIST_ASSERT(rangeArray[i] == i % 8);
+		}
+
+		size_t* uninitialized = rangeArray.AppendUninitialized(4);
+		MIST_ASSERT(uninitialized == rangeArray.GetValue(16));
+		MIST_ASSERT(rangeArray.Size() == 20);
+
+		// Assure that the bulk fill matches the default value
+		rangeArray.Resize(100, 7);
+		MIST_ASSERT(rangeArray.Size() == 100);
+		MIST_ASSERT(rangeArray.ReservedSize() == 100);
+		for (size_t i = 20; i < 100; i++) {
+			MIST_ASSERT(rangeArray[i] == 7);
+		}
+
+		rangeArray.Resize(200);
+		for (size_t i = 100; i < 200; i++) {
+			MIST_ASSERT(rangeArray[i] == 0);
+		}
+
+		// Assure that a range of the array itself survives the array growing
+		rangeArray.InsertRange(rangeArray.begin(), rangeArray.end());
+		MIST_ASSERT(rangeArray.Size() == 400);
+		for (size_t i = 0; i < 200; i++) {
+			MIST_ASSERT(rangeArray[i + 200] == rangeArray[i]);
+		}
+
+		// Assure that non trivial types are constructed one by one
+		Mist::DynamicArray<std::vector<size_t>> vectorArray;
+		std::vector<size_t> vectors[] = { { 1 }, { 2 }, { 3 } };
+		vectorArray.InsertRange(std::begin(vectors), std::end(vectors));
+		vectorArray.Resize(10, 2, 4);
+		MIST_ASSERT(vectorArray[2][0] == 3);
+		MIST_ASSERT(vectorArray[9].size() == 2 && vectorArray[9][1] == 4);
+
+		vectorArray.InsertRange(vectorArray.begin() + 1, vectorArray.begin() + 3);
+		MIST_ASSERT(vectorArray.Size() == 12);
+		MIST_ASSERT(vectorArray[10][0] == 2 && vectorArray[11][0] == 3);
+	}
+
+	{
+		// Assure that clearing can keep the reserved memory
+		Mist::DynamicArray<size_t> clearArray;
+		clearArray.Resize(50, 1);
+		size_t* memory = clearArray.AsRawArray();
+		clearArray.ClearKeepCapacity();
+		MIST_ASSERT(clearArray.Size() == 0);
+		MIST_ASSERT(clearArray.ReservedSize() == 50);
+		MIST_ASSERT(clearArray.AsRawArray() == memory);
+
+		clearArray.InsertAsLast(5);
+		clearArray.InsertAsLast(6);
+		clearArray.InsertAsLast(7);
+		clearArray.RemoveLast(2);
+		MIST_ASSERT(clearArray.Size() == 1 && clearArray[0] == 5);
+
+		clearArray.Clear();
+		MIST_ASSERT(clearArray.ReservedSize() == 0);
+	}
+
 	std::cout << "Dynamic Array Tests Passed" << std::endl;
 }
 
+void TestInlineDynamicArray() {
+
+	std::cout << "Testing Inline Dynamic Array" << std::endl;
+
+	Mist::InlineDynamicArray<size_t, 4> testArray;
+	MIST_ASSERT(testArray.Size() == 0);
+	MIST_ASSERT(testArray.ReservedSize() == 4);
+	MIST_ASSERT(testArray.IsInline());
+
+	for (size_t i = 0; i < 4; i++) {
+		testArray.InsertAsLast(i);
+	}
+	// Assure that we don't allocate until we've passed the inline count
+	MIST_ASSERT(testArray.IsInline());
+
+	testArray.InsertAsLast(4);
+	MIST_ASSERT(testArray.IsInline() == false);
+	MIST_ASSERT(testArray.ReservedSize() >= 5);
+
+	size_t expected = 0;
+	for (auto i : testArray) {
+		MIST_ASSERT(i == expected++);
+	}
+	MIST_ASSERT(*testArray.FirstValue() == 0 && *testArray.LastValue() == 4);
+
+	// Assure that moving steals the allocated memory
+	Mist::InlineDynamicArray<size_t, 4> movedArray(std::move(testArray));
+	MIST_ASSERT(movedArray.Size() == 5 && movedArray[4] == 4);
+	MIST_ASSERT(testArray.Size() == 0 && testArray.IsInline());
+
+	// Assure that moving copies the inline elements
+	testArray.InsertAsLast(10);
+	movedArray = std::move(testArray);
+	MIST_ASSERT(movedArray.IsInline());
+	MIST_ASSERT(movedArray.Size() == 1 && movedArray[0] == 10);
+
+	movedArray.RemoveLast();
+	MIST_ASSERT(movedArray.Size() == 0);
+
+	movedArray.ReserveAdditional(10);
+	MIST_ASSERT(movedArray.IsInline() == false);
+	movedArray.Clear();
+	MIST_ASSERT(movedArray.IsInline());
+
+	std::cout << "Inline Dynamic Array Tests Passed" << std::endl;
+}
+
 int main() {
 
 	TestRingBuffer();
+	TestSpscRingBuffer();
+	TestMpmcRingBuffer();
+	TestDynamicRingBuffer();
 	TestSorting();
+	TestExternalSort();
 	TestBitManipulations();
 	//TestReflection();
 	//TestHash();
 	TestSingleList();
 	TestAllocator();
+	TestLinearAllocator();
+	TestPoolAllocator();
 	TestDynamicArray();
+	TestInlineDynamicArray();
 
 	Pause();
 	return 0;